@@ -0,0 +1,300 @@
+#ifndef C2LINKLIST_H
+#define C2LINKLIST_H
+
+#include <iostream>
+#include <new> // For placement new
+#include "NodePool.h"
+
+struct D_NODE
+{
+    int data;
+    D_NODE *next;
+    D_NODE *prev;
+};
+
+// NodeAlloc: node allocation policy (see NodePool.h). The default allocates
+// each node on the heap; NodePool<D_NODE> packs nodes into reusable slabs.
+template <template <typename> class NodeAlloc = HeapNodeAlloc>
+class C2LinkList
+{
+private:
+    D_NODE *head;            // Points to an arbitrary node in the circle, often the "first"
+    int length;              // Number of nodes, kept up to date for an O(1) Length
+    NodeAlloc<D_NODE> nodes; // Supplies and reclaims node storage
+
+public:
+    // Constructor
+    C2LinkList();
+    // Destructor
+    ~C2LinkList();
+
+    // --- Basic Operations ---
+    void ClearList();
+    bool IsEmpty();
+    int Length();
+    void Traverse(); // A helper to print the list
+
+    // --- Core Data Operations ---
+
+    D_NODE *GetElemP(int i); // Helper to get a pointer to the ith node
+    bool Insert(int i, int e);
+    bool Delete(int i, int &e);
+    bool PushBack(int e);    // Appends after the last node (head->prev) in O(1)
+    bool PopBack(int &e);    // Removes the last node in O(1)
+};
+
+// --- Function Implementations ---
+
+// Constructor: Initializes an empty list.
+template <template <typename> class NodeAlloc>
+C2LinkList<NodeAlloc>::C2LinkList()
+{
+    head = nullptr;
+    length = 0;
+}
+
+// Destructor: Cleans up all dynamically allocated nodes.
+template <template <typename> class NodeAlloc>
+C2LinkList<NodeAlloc>::~C2LinkList()
+{
+    std::cout << "\n--- C2LinkList Destructor Called: Cleaning up memory... ---" << std::endl;
+    ClearList();
+}
+
+// ClearList: Deletes all nodes, freeing their memory.
+// A pooling policy takes back all nodes at once instead of one by one.
+template <template <typename> class NodeAlloc>
+void C2LinkList<NodeAlloc>::ClearList()
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+    if (NodeAlloc<D_NODE>::kBulkRelease)
+    {
+        nodes.ReleaseAll();
+        head = nullptr;
+        length = 0;
+        return;
+    }
+
+    D_NODE *current = head->next;
+    while (current != head)
+    {
+        D_NODE *node_to_delete = current;
+        current = current->next;
+        nodes.Deallocate(node_to_delete);
+    }
+    nodes.Deallocate(head); // Delete the last remaining node
+    head = nullptr;
+    length = 0;
+}
+
+// IsEmpty: Checks if the list is empty.
+template <template <typename> class NodeAlloc>
+bool C2LinkList<NodeAlloc>::IsEmpty()
+{
+    return head == nullptr;
+}
+
+// Length: Returns the number of elements. O(1), the count is maintained
+// by Insert, Delete, PushBack and PopBack.
+template <template <typename> class NodeAlloc>
+int C2LinkList<NodeAlloc>::Length()
+{
+    return length;
+}
+
+// Traverse: A utility function to print the contents of the list.
+template <template <typename> class NodeAlloc>
+void C2LinkList<NodeAlloc>::Traverse()
+{
+    if (IsEmpty())
+    {
+        std::cout << "List is empty. | Length: 0" << std::endl;
+        return;
+    }
+    std::cout << "List contents: head -> ";
+    D_NODE *current = head;
+    do
+    {
+        std::cout << current->data << " <-> ";
+        current = current->next;
+    } while (current != head);
+    std::cout << "(head:" << head->data << ") | Length: " << length << std::endl;
+}
+
+// GetElemP: Helper function to get a pointer to the ith node.
+// Walks forward from head for the first half of the list and backward via
+// prev for the second half, so at most length/2 steps are taken.
+// Returns nullptr if i is out of range.
+template <template <typename> class NodeAlloc>
+D_NODE *C2LinkList<NodeAlloc>::GetElemP(int i)
+{
+    if (i < 0 || i >= length)
+        return nullptr;
+
+    D_NODE *p = head;
+    if (i <= length / 2)
+    {
+        for (int j = 0; j < i; ++j)
+        {
+            p = p->next;
+        }
+    }
+    else
+    {
+        for (int j = length; j > i; --j)
+        {
+            p = p->prev;
+        }
+    }
+    return p;
+}
+
+// Insert: Inserts element 'e' at position 'i'.
+template <template <typename> class NodeAlloc>
+bool C2LinkList<NodeAlloc>::Insert(int i, int e)
+{
+    if (i < 0)
+        return false;
+
+    void *mem = nodes.Allocate();
+    if (mem == nullptr)
+        return false; // Memory allocation failed
+    D_NODE *new_node = new (mem) D_NODE;
+    new_node->data = e;
+
+    // Case 1: The list is empty
+    if (IsEmpty())
+    {
+        head = new_node;
+        head->next = head;
+        head->prev = head;
+        length = 1;
+        return true;
+    }
+
+    // Find the node `p` that will be at position `i` *after* insertion
+    D_NODE *p = GetElemP(i);
+    if (p == nullptr)
+    { // This can happen if i >= length
+        // Insert at the end, which is before the head
+        p = head;
+    }
+
+    // Get the predecessor of p
+    D_NODE *p_prev = p->prev;
+
+    // Perform the pointer updates as per the slide
+    new_node->prev = p_prev; // Step 1
+    p_prev->next = new_node; // Step 2
+    new_node->next = p;      // Step 3
+    p->prev = new_node;      // Step 4
+
+    // If we inserted before the old head, the new node becomes the head
+    if (i == 0)
+    {
+        head = new_node;
+    }
+
+    length++;
+    return true;
+}
+
+// Delete: Deletes the element at position 'i'.
+template <template <typename> class NodeAlloc>
+bool C2LinkList<NodeAlloc>::Delete(int i, int &e)
+{
+    if (i < 0 || IsEmpty())
+        return false;
+
+    // Find the node to be deleted
+    D_NODE *p = GetElemP(i);
+    if (p == nullptr)
+        return false; // Index out of bounds
+
+    // Case 1: Deleting the only node in the list
+    if (p->next == p)
+    {
+        e = p->data;
+        nodes.Deallocate(p);
+        head = nullptr;
+        length = 0;
+        return true;
+    }
+
+    // Case 2: Deleting from a list with more than one node
+    D_NODE *p_prev = p->prev;
+    D_NODE *p_next = p->next;
+
+    // Perform pointer updates as per the slide
+    p_prev->next = p_next; // Step 1
+    p_next->prev = p_prev; // Step 2
+
+    e = p->data;
+
+    // If we deleted the head, update head to the next node
+    if (p == head)
+    {
+        head = p_next;
+    }
+
+    nodes.Deallocate(p); // Step 3
+    length--;
+    return true;
+}
+
+// PushBack: Appends 'e' after the last node. The last node is head->prev,
+// so no index walk is needed.
+template <template <typename> class NodeAlloc>
+bool C2LinkList<NodeAlloc>::PushBack(int e)
+{
+    void *mem = nodes.Allocate();
+    if (mem == nullptr)
+        return false; // Memory allocation failed
+    D_NODE *new_node = new (mem) D_NODE;
+    new_node->data = e;
+
+    if (IsEmpty())
+    {
+        head = new_node;
+        head->next = head;
+        head->prev = head;
+        length = 1;
+        return true;
+    }
+
+    D_NODE *last = head->prev;
+    new_node->prev = last;
+    last->next = new_node;
+    new_node->next = head;
+    head->prev = new_node;
+    length++;
+    return true;
+}
+
+// PopBack: Removes the last node (head->prev) and returns its data in 'e'.
+template <template <typename> class NodeAlloc>
+bool C2LinkList<NodeAlloc>::PopBack(int &e)
+{
+    if (IsEmpty())
+        return false;
+
+    D_NODE *last = head->prev;
+    e = last->data;
+    if (last == head)
+    { // Removing the only node
+        head = nullptr;
+    }
+    else
+    {
+        last->prev->next = head;
+        head->prev = last->prev;
+    }
+    nodes.Deallocate(last);
+    length--;
+    return true;
+}
+
+#endif // C2LINKLIST_H
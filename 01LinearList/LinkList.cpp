@@ -1,229 +1,12 @@
 #include <iostream>
-
-// Node structure for the Singly Linked List
-struct NODE
-{
-    int data;
-    NODE *next;
-};
-
-class LinkList
-{
-private:
-    NODE *head; // Points to the first node in the list
-
-public:
-    // Constructor
-    LinkList();
-    // Destructor (crucial for freeing memory)
-    ~LinkList();
-
-    // --- Basic Operations ---
-
-    void ClearList();
-    bool IsEmpty();
-    int Length();
-    void Traverse(); // A helper to print the list
-
-    // --- Core Data Operations ---
-
-    bool GetElem(int i, int &e);
-    int LocateElem(int e);
-    bool Insert(int i, int e);
-    bool Delete(int i, int &e);
-};
-
-// --- Function Implementations ---
-
-// Constructor: Initializes an empty list.
-LinkList::LinkList()
-{
-    head = nullptr;
-}
-
-// Destructor: Cleans up all dynamically allocated nodes.
-LinkList::~LinkList()
-{
-    std::cout << "\n--- LinkList Destructor Called: Cleaning up memory... ---" << std::endl;
-    ClearList();
-}
-
-// ClearList: Deletes all nodes, freeing their memory.
-void LinkList::ClearList()
-{
-    NODE *current = head;
-    while (current != nullptr)
-    {
-        NODE *node_to_delete = current;
-        current = current->next;
-        delete node_to_delete;
-    }
-    head = nullptr; // Reset the list to an empty state
-}
-
-// IsEmpty: Checks if the list is empty.
-bool LinkList::IsEmpty()
-{
-    return head == nullptr;
-}
-
-// Length: Returns the number of elements by traversing the list.
-int LinkList::Length()
-{
-    int count = 0;
-    NODE *current = head;
-    while (current != nullptr)
-    {
-        count++;
-        current = current->next;
-    }
-    return count;
-}
-
-// Traverse: A utility function to print the contents of the list.
-void LinkList::Traverse()
-{
-    std::cout << "List contents: head -> ";
-    NODE *current = head;
-    while (current != nullptr)
-    {
-        std::cout << current->data << " -> ";
-        current = current->next;
-    }
-    std::cout << "nullptr | Length: " << this->Length() << std::endl;
-}
-
-// GetElem: Retrieves the element at a specific position 'i' (0-based).
-bool LinkList::GetElem(int i, int &e)
-{
-    if (i < 0)
-        return false;
-
-    NODE *p = head;
-    int j = 0;
-    while (p != nullptr && j < i)
-    { // Traverse to the ith node
-        p = p->next;
-        j++;
-    }
-
-    if (p == nullptr)
-    { // Index is out of bounds
-        return false;
-    }
-
-    e = p->data;
-    // Retrieve the data
-    return true;
-}
-
-// LocateElem: Returns the index of the first occurrence of element 'e'.
-int LinkList::LocateElem(int e)
-{
-    NODE *p = head;
-    int index = 0;
-    while (p != nullptr)
-    {
-        if (p->data == e)
-        {
-            return index;
-        }
-        p = p->next;
-        index++;
-    }
-    return -1; // Element not found
-}
-
-// Insert: Inserts element 'e' at position 'i'.
-bool LinkList::Insert(int i, int e)
-{
-    if (i < 0)
-        return false;
-
-    NODE *new_node = new NODE;
-    new_node->data = e;
-
-    // Case 1: Insert at the head (i = 0)
-    if (i == 0)
-    {
-        new_node->next = head;
-        head = new_node;
-        return true;
-    }
-
-    // Case 2: Insert at a position other than the head
-    NODE *p = head;
-    int j = 0;
-    // Traverse to the node *before* the insertion point (at index i-1)
-    while (p != nullptr && j < i - 1)
-    {
-        p = p->next;
-        j++;
-    }
-
-    if (p == nullptr)
-    {                    // The list is shorter than i-1, invalid index
-        delete new_node; // Clean up the allocated node
-        return false;
-    }
-
-    // Perform the insertion
-    new_node->next = p->next;
-    p->next = new_node;
-    return true;
-}
-
-// Delete: Deletes the element at position 'i'.
-bool LinkList::Delete(int i, int &e)
-{
-    if (i < 0 || IsEmpty())
-        return false;
-
-    NODE *node_to_delete = nullptr;
-
-    // Case 1: Delete the head node (i = 0)
-    if (i == 0)
-    {
-        node_to_delete = head;
-        e = head->data;
-        head = head->next;
-        delete node_to_delete;
-        return true;
-    }
-
-    // Case 2: Delete a node other than the head
-    NODE *p = head;
-    int j = 0;
-    // Traverse to the node *before* the one to be deleted (at index i-1)
-    while (p != nullptr && j < i - 1)
-    {
-        p = p->next;
-        j++;
-    }
-
-    // Check if predecessor or the target node is valid
-    if (p == nullptr || p->next == nullptr)
-    {
-        return false; // Invalid index
-    }
-
-    // Perform the deletion
-    node_to_delete = p->next;
-    e = node_to_delete->data;
-    p->next = node_to_delete->next;
-    // Bypass the deleted node
-    delete node_to_delete;
-    // Free memory
-
-    return true;
-}
+#include "LinkList.h"
 
 // --- Main function acting as a Testbench ---
 
 int main()
 {
     std::cout << "--- Initializing LinkList Testbench ---" << std::endl;
-    LinkList myList;
+    LinkList<> myList;
 
     // Test 1: Initial state
     std::cout << "\n[Test 1: Initial State]" << std::endl;
@@ -289,6 +72,43 @@ int main()
     bool delete_fail = myList.Delete(0, deleted_val);
     std::cout << "Attempt to delete from empty list: " << (delete_fail ? "Success" : "Failed (Correct)") << std::endl;
 
+    // Test 8: Sequential access with the finger
+    std::cout << "\n[Test 8: Sequential GetElem / Append]" << std::endl;
+    for (int k = 0; k < 10; ++k)
+    {
+        myList.Insert(myList.Length(), k * k); // O(1) append through the tail
+    }
+    std::cout << "Reading by index: ";
+    for (int k = 0; k < myList.Length(); ++k)
+    {
+        myList.GetElem(k, val); // Resumes from the previous node
+        std::cout << val << " ";
+    }
+    std::cout << "| Length: " << myList.Length() << std::endl;
+    myList.Delete(9, deleted_val); // Delete the tail, then append again
+    myList.Insert(9, -81);
+    myList.Delete(0, deleted_val);
+    myList.Traverse();
+    myList.ClearList();
+
+    // Test 9: Pooled node allocation
+    std::cout << "\n[Test 9: LinkList<NodePool>]" << std::endl;
+    {
+        LinkList<NodePool> pooledList;
+        for (int round = 0; round < 3; ++round)
+        {
+            for (int k = 0; k < 5; ++k)
+            {
+                pooledList.Insert(0, round * 10 + k);
+            }
+            pooledList.Delete(1, deleted_val); // Slot goes to the free list and is reused
+            pooledList.Insert(1, -1);
+            pooledList.Traverse();
+            pooledList.ClearList(); // Whole slab returned at once
+        }
+        std::cout << "Is pooled list empty after clearing? " << (pooledList.IsEmpty() ? "Yes" : "No") << std::endl;
+    }
+
     std::cout << "\n--- Testbench Complete ---" << std::endl;
     // The destructor will be automatically called here when main() ends.
     return 0;
@@ -0,0 +1,284 @@
+#ifndef LINKLIST_H
+#define LINKLIST_H
+
+#include <iostream>
+#include <new> // For placement new
+#include "NodePool.h"
+
+// Node structure for the Singly Linked List
+struct NODE
+{
+    int data;
+    NODE *next;
+};
+
+// NodeAlloc: node allocation policy (see NodePool.h). The default allocates
+// each node on the heap; NodePool<NODE> packs nodes into reusable slabs.
+template <template <typename> class NodeAlloc = HeapNodeAlloc>
+class LinkList
+{
+private:
+    NODE *head;            // Points to the first node in the list
+    NODE *tail;            // Points to the last node, for O(1) append
+    int length;            // Number of nodes, kept up to date for an O(1) Length
+    NODE *finger;          // Node most recently reached by index (nullptr if unset)
+    int finger_index;      // Index of 'finger'
+    NodeAlloc<NODE> nodes; // Supplies and reclaims node storage
+
+    // Returns the node at index i (0 <= i < length), walking from the finger
+    // when it lies at or before i, and moves the finger there.
+    NODE *NodeAt(int i);
+
+public:
+    // Constructor
+    LinkList();
+    // Destructor (crucial for freeing memory)
+    ~LinkList();
+
+    // --- Basic Operations ---
+
+    void ClearList();
+    bool IsEmpty();
+    int Length();
+    void Traverse(); // A helper to print the list
+
+    // --- Core Data Operations ---
+
+    bool GetElem(int i, int &e);
+    int LocateElem(int e);
+    bool Insert(int i, int e);
+    bool Delete(int i, int &e);
+};
+
+// --- Function Implementations ---
+
+// Constructor: Initializes an empty list.
+template <template <typename> class NodeAlloc>
+LinkList<NodeAlloc>::LinkList()
+{
+    head = nullptr;
+    tail = nullptr;
+    length = 0;
+    finger = nullptr;
+    finger_index = 0;
+}
+
+// Destructor: Cleans up all dynamically allocated nodes.
+template <template <typename> class NodeAlloc>
+LinkList<NodeAlloc>::~LinkList()
+{
+    std::cout << "\n--- LinkList Destructor Called: Cleaning up memory... ---" << std::endl;
+    ClearList();
+}
+
+// ClearList: Deletes all nodes, freeing their memory.
+// A pooling policy takes back all nodes at once instead of one by one.
+template <template <typename> class NodeAlloc>
+void LinkList<NodeAlloc>::ClearList()
+{
+    if (NodeAlloc<NODE>::kBulkRelease)
+    {
+        nodes.ReleaseAll();
+    }
+    else
+    {
+        NODE *current = head;
+        while (current != nullptr)
+        {
+            NODE *node_to_delete = current;
+            current = current->next;
+            nodes.Deallocate(node_to_delete);
+        }
+    }
+    head = nullptr; // Reset the list to an empty state
+    tail = nullptr;
+    length = 0;
+    finger = nullptr;
+}
+
+// IsEmpty: Checks if the list is empty.
+template <template <typename> class NodeAlloc>
+bool LinkList<NodeAlloc>::IsEmpty()
+{
+    return head == nullptr;
+}
+
+// Length: Returns the number of elements. O(1), the count is maintained
+// by Insert and Delete.
+template <template <typename> class NodeAlloc>
+int LinkList<NodeAlloc>::Length()
+{
+    return length;
+}
+
+// Traverse: A utility function to print the contents of the list.
+template <template <typename> class NodeAlloc>
+void LinkList<NodeAlloc>::Traverse()
+{
+    std::cout << "List contents: head -> ";
+    NODE *current = head;
+    while (current != nullptr)
+    {
+        std::cout << current->data << " -> ";
+        current = current->next;
+    }
+    std::cout << "nullptr | Length: " << length << std::endl;
+}
+
+// NodeAt: Walks to the node at index i. Resuming from the finger makes a
+// loop over increasing indices O(n) in total instead of O(n^2).
+template <template <typename> class NodeAlloc>
+NODE *LinkList<NodeAlloc>::NodeAt(int i)
+{
+    NODE *p = head;
+    int j = 0;
+    if (i == length - 1)
+    {
+        p = tail;
+        j = i;
+    }
+    else if (finger != nullptr && finger_index <= i)
+    {
+        p = finger;
+        j = finger_index;
+    }
+    while (j < i)
+    { // Traverse to the ith node
+        p = p->next;
+        j++;
+    }
+    finger = p;
+    finger_index = i;
+    return p;
+}
+
+// GetElem: Retrieves the element at a specific position 'i' (0-based).
+template <template <typename> class NodeAlloc>
+bool LinkList<NodeAlloc>::GetElem(int i, int &e)
+{
+    if (i < 0 || i >= length)
+    { // Index is out of bounds
+        return false;
+    }
+
+    e = NodeAt(i)->data;
+    // Retrieve the data
+    return true;
+}
+
+// LocateElem: Returns the index of the first occurrence of element 'e'.
+template <template <typename> class NodeAlloc>
+int LinkList<NodeAlloc>::LocateElem(int e)
+{
+    NODE *p = head;
+    int index = 0;
+    while (p != nullptr)
+    {
+        if (p->data == e)
+        {
+            return index;
+        }
+        p = p->next;
+        index++;
+    }
+    return -1; // Element not found
+}
+
+// Insert: Inserts element 'e' at position 'i'.
+// Appending (i == Length()) goes straight to the tail in O(1).
+template <template <typename> class NodeAlloc>
+bool LinkList<NodeAlloc>::Insert(int i, int e)
+{
+    if (i < 0 || i > length)
+        return false; // Invalid index
+
+    void *mem = nodes.Allocate();
+    if (mem == nullptr)
+        return false; // Memory allocation failed
+    NODE *new_node = new (mem) NODE;
+    new_node->data = e;
+
+    // Case 1: Insert at the head (i = 0)
+    if (i == 0)
+    {
+        new_node->next = head;
+        head = new_node;
+        if (tail == nullptr)
+        {
+            tail = new_node;
+        }
+        finger_index++; // Every old node moved one position back
+        length++;
+        return true;
+    }
+
+    // Case 2: Append after the tail (i = length)
+    if (i == length)
+    {
+        new_node->next = nullptr;
+        tail->next = new_node;
+        tail = new_node;
+        length++;
+        return true;
+    }
+
+    // Case 3: Insert in the middle, after the node at index i-1
+    NODE *p = NodeAt(i - 1);
+
+    // Perform the insertion
+    new_node->next = p->next;
+    p->next = new_node;
+    length++;
+    return true;
+}
+
+// Delete: Deletes the element at position 'i'.
+template <template <typename> class NodeAlloc>
+bool LinkList<NodeAlloc>::Delete(int i, int &e)
+{
+    if (i < 0 || i >= length)
+        return false; // Invalid index or empty list
+
+    NODE *node_to_delete = nullptr;
+
+    // Case 1: Delete the head node (i = 0)
+    if (i == 0)
+    {
+        node_to_delete = head;
+        e = head->data;
+        head = head->next;
+        if (head == nullptr)
+        {
+            tail = nullptr;
+        }
+        if (finger == node_to_delete)
+        {
+            finger = nullptr;
+        }
+        finger_index--;
+        nodes.Deallocate(node_to_delete);
+        length--;
+        return true;
+    }
+
+    // Case 2: Delete a node other than the head
+    // Move to the node *before* the one to be deleted (at index i-1)
+    NODE *p = NodeAt(i - 1);
+
+    // Perform the deletion
+    node_to_delete = p->next;
+    e = node_to_delete->data;
+    p->next = node_to_delete->next;
+    // Bypass the deleted node
+    if (node_to_delete == tail)
+    {
+        tail = p;
+    }
+    nodes.Deallocate(node_to_delete);
+    // Free memory
+    length--;
+
+    return true;
+}
+
+#endif // LINKLIST_H
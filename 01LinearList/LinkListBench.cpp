@@ -0,0 +1,172 @@
+#include <iostream>
+#include <iomanip> // For std::setw
+#include <forward_list>
+#include <iterator> // For std::next
+#include <algorithm> // For std::find
+#include <vector>
+#include <random>
+#include <chrono>
+#include "LinkList.h"
+#include "UnrolledLinkList.h"
+
+/**
+ * Benchmark: LinkList vs UnrolledLinkList vs std::forward_list.
+ * For n = 10^3 .. 10^7 it measures
+ *   - scan:   a full LocateElem for a missing value (ns per element)
+ *   - insert: Insert at a random index (ns per operation)
+ *   - delete: Delete at a random index (ns per operation)
+ * Random positions are drawn once per n and replayed on every container.
+ */
+
+typedef std::chrono::steady_clock Clock;
+
+double ElapsedNs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// Adapter giving std::forward_list the LinkList interface used below.
+class ForwardListAdapter
+{
+private:
+    std::forward_list<int> flist;
+
+public:
+    void Build(int n)
+    {
+        auto it = flist.before_begin();
+        for (int k = 0; k < n; ++k)
+        {
+            it = flist.insert_after(it, k);
+        }
+    }
+    int LocateElem(int e)
+    {
+        auto it = std::find(flist.begin(), flist.end(), e);
+        return it == flist.end() ? -1 : static_cast<int>(std::distance(flist.begin(), it));
+    }
+    bool Insert(int i, int e)
+    {
+        flist.insert_after(std::next(flist.before_begin(), i), e);
+        return true;
+    }
+    bool Delete(int i, int &e)
+    {
+        auto before = std::next(flist.before_begin(), i);
+        e = *std::next(before);
+        flist.erase_after(before);
+        return true;
+    }
+};
+
+// Build: Appends 0..n-1 through the container's own Insert.
+template <typename List>
+void Build(List &list, int n)
+{
+    for (int k = 0; k < n; ++k)
+    {
+        list.Insert(k, k);
+    }
+}
+
+void Build(ForwardListAdapter &list, int n)
+{
+    list.Build(n);
+}
+
+struct Result
+{
+    double scan_ns;   // per element
+    double insert_ns; // per operation
+    double delete_ns; // per operation
+    long long checksum;
+};
+
+template <typename List>
+Result Run(List &list, int n, int scans, const std::vector<int> &insert_pos, const std::vector<int> &delete_pos)
+{
+    Result r;
+    r.checksum = 0;
+    Build(list, n);
+
+    Clock::time_point start = Clock::now();
+    for (int s = 0; s < scans; ++s)
+    {
+        r.checksum += list.LocateElem(-1); // Not present: walks the whole list
+    }
+    r.scan_ns = ElapsedNs(start) / (static_cast<double>(scans) * n);
+
+    start = Clock::now();
+    for (int i : insert_pos)
+    {
+        list.Insert(i, i);
+    }
+    r.insert_ns = ElapsedNs(start) / insert_pos.size();
+
+    start = Clock::now();
+    int e = 0;
+    for (int i : delete_pos)
+    {
+        list.Delete(i, e);
+        r.checksum += e;
+    }
+    r.delete_ns = ElapsedNs(start) / delete_pos.size();
+    return r;
+}
+
+void Print(const char *name, const Result &r)
+{
+    std::cout << std::setw(22) << name << std::fixed << std::setprecision(2)
+              << std::setw(14) << r.scan_ns << std::setw(16) << r.insert_ns
+              << std::setw(16) << r.delete_ns << std::endl;
+}
+
+int main()
+{
+    std::cout << "--- LinkList / UnrolledLinkList / std::forward_list Benchmark ---" << std::endl;
+    std::mt19937 rng(2025);
+
+    for (int n = 1000; n <= 10000000; n *= 10)
+    {
+        // Random operations on linked lists cost O(n) each, so fewer are run on long lists.
+        int ops = std::max(10, std::min(10000, 100000000 / n));
+        int scans = std::max(1, 10000000 / n);
+        std::vector<int> insert_pos(ops), delete_pos(ops);
+        for (int k = 0; k < ops; ++k)
+        {
+            insert_pos[k] = static_cast<int>(rng() % (n + k + 1));
+        }
+        for (int k = 0; k < ops; ++k)
+        {
+            delete_pos[k] = static_cast<int>(rng() % (n + ops - k));
+        }
+
+        std::cout << "\nn = " << n << " (" << ops << " random inserts/deletes)" << std::endl;
+        std::cout << std::setw(22) << "container" << std::setw(14) << "scan ns/elem"
+                  << std::setw(16) << "insert ns/op" << std::setw(16) << "delete ns/op" << std::endl;
+
+        Result base;
+        {
+            LinkList<> list;
+            base = Run(list, n, scans, insert_pos, delete_pos);
+            Print("LinkList", base);
+        }
+        {
+            UnrolledLinkList list;
+            Result r = Run(list, n, scans, insert_pos, delete_pos);
+            Print("UnrolledLinkList", r);
+            if (r.checksum != base.checksum)
+                std::cout << "Mismatch: UnrolledLinkList disagrees with LinkList!" << std::endl;
+        }
+        {
+            ForwardListAdapter list;
+            Result r = Run(list, n, scans, insert_pos, delete_pos);
+            Print("std::forward_list", r);
+            if (r.checksum != base.checksum)
+                std::cout << "Mismatch: std::forward_list disagrees with LinkList!" << std::endl;
+        }
+    }
+
+    std::cout << "\n--- Benchmark Complete ---" << std::endl;
+    return 0;
+}
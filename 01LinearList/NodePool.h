@@ -0,0 +1,148 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <new>    // For ::operator new, std::nothrow
+#include <vector>
+#include <cstddef> // For std::size_t
+
+/**
+ * Node allocation policies for the linked containers
+ * (LinkList, C2LinkList and LinkedStack).
+ *
+ * A policy is a class template over the node type with this interface:
+ *   void *Allocate();          // Raw storage for one Node, nullptr on failure
+ *   void Deallocate(void *p);  // Returns storage obtained from Allocate
+ *   void ReleaseAll();         // Returns every node at once (only if kBulkRelease)
+ *   static const bool kBulkRelease;
+ *
+ * The container owns its policy object, so ReleaseAll may only be used when
+ * the container is dropping all of its nodes.
+ */
+
+/**
+ * @class HeapNodeAlloc
+ * @brief Default policy: one heap allocation per node, as with plain new/delete.
+ */
+template <typename Node>
+class HeapNodeAlloc
+{
+public:
+    static const bool kBulkRelease = false;
+
+    void *Allocate()
+    {
+        return ::operator new(sizeof(Node), std::nothrow);
+    }
+
+    void Deallocate(void *p)
+    {
+        ::operator delete(p);
+    }
+
+    void ReleaseAll() {} // Not supported: nodes must be freed one by one
+};
+
+/**
+ * @class NodePool
+ * @brief Slab allocator with a free list.
+ * Nodes are carved consecutively out of slabs of 'slab_nodes' nodes, so a list
+ * built by successive inserts sits contiguously in memory. Deallocated nodes go
+ * onto an intrusive free list and are reused first. ReleaseAll rewinds the bump
+ * pointer to the first slab in O(1); the slabs are kept for reuse and only
+ * returned to the system by the destructor.
+ */
+template <typename Node>
+class NodePool
+{
+private:
+    struct FreeSlot
+    {
+        FreeSlot *next;
+    };
+    union Slot // Storage for one node; doubles as a free-list link when unused
+    {
+        alignas(Node) unsigned char node[sizeof(Node)];
+        FreeSlot free;
+    };
+
+    std::vector<Slot *> slabs; // Every slab allocated so far
+    std::size_t slab_nodes;    // Nodes per slab
+    std::size_t cur;           // Index of the slab being carved
+    std::size_t used;          // Slots already handed out from slabs[cur]
+    FreeSlot *free_list;       // Deallocated slots, most recent first
+
+public:
+    static const bool kBulkRelease = true;
+
+    explicit NodePool(std::size_t nodes_per_slab = 1024)
+        : slab_nodes(nodes_per_slab > 0 ? nodes_per_slab : 1), cur(0), used(0), free_list(nullptr) {}
+
+    ~NodePool()
+    {
+        for (Slot *slab : slabs)
+        {
+            ::operator delete(slab);
+        }
+    }
+
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    // Allocate: Pops the free list, otherwise bumps within the current slab.
+    void *Allocate()
+    {
+        if (free_list != nullptr)
+        {
+            FreeSlot *slot = free_list;
+            free_list = slot->next;
+            return slot;
+        }
+        if (slabs.empty() || used == slab_nodes)
+        {
+            if (!slabs.empty())
+            {
+                cur++;
+                used = 0;
+            }
+            if (cur == slabs.size()) // No slab left over from before a ReleaseAll
+            {
+                void *slab = ::operator new(sizeof(Slot) * slab_nodes, std::nothrow);
+                if (slab == nullptr)
+                {
+                    if (cur > 0)
+                    {
+                        cur--; // Stay on the full slab so the next call retries
+                        used = slab_nodes;
+                    }
+                    return nullptr;
+                }
+                slabs.push_back(static_cast<Slot *>(slab));
+            }
+        }
+        return &slabs[cur][used++];
+    }
+
+    // Deallocate: Pushes the slot onto the free list. O(1).
+    void Deallocate(void *p)
+    {
+        FreeSlot *slot = static_cast<FreeSlot *>(p);
+        slot->next = free_list;
+        free_list = slot;
+    }
+
+    // ReleaseAll: Forgets every outstanding node in O(1).
+    void ReleaseAll()
+    {
+        cur = 0;
+        used = 0;
+        free_list = nullptr;
+    }
+
+    // SlabCount: Number of slabs currently held (for testing).
+    std::size_t SlabCount() const
+    {
+        return slabs.size();
+    }
+};
+
+#endif // NODEPOOL_H
@@ -0,0 +1,102 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm> // For std::lower_bound, std::upper_bound
+#include "SkipList.h"
+
+// --- Main function acting as a Testbench ---
+
+int main()
+{
+    std::cout << "--- Initializing SkipList Testbench ---" << std::endl;
+    SkipList myList;
+
+    // Test 1: Initial state
+    std::cout << "\n[Test 1: Initial State]" << std::endl;
+    std::cout << "Is list empty? " << (myList.IsEmpty() ? "Yes" : "No") << std::endl;
+    myList.Traverse();
+
+    // Test 2: Insertion keeps ascending order
+    std::cout << "\n[Test 2: Insertion]" << std::endl;
+    int keys[] = {30, 10, 50, 20, 40, 20};
+    for (int k : keys)
+    {
+        myList.Insert(k);
+    }
+    myList.Traverse();
+
+    // Test 3: Search by key and by rank
+    std::cout << "\n[Test 3: LocateElem / GetElem]" << std::endl;
+    std::cout << "Locating element 20 (first of two). Rank: " << myList.LocateElem(20) << std::endl;
+    std::cout << "Locating element 50. Rank: " << myList.LocateElem(50) << std::endl;
+    std::cout << "Locating element 99 (not in list). Rank: " << myList.LocateElem(99) << std::endl;
+    int val;
+    if (myList.GetElem(3, val))
+    {
+        std::cout << "Element with rank 3 is: " << val << std::endl;
+    }
+    if (!myList.GetElem(6, val))
+    {
+        std::cout << "Attempt to get element with invalid rank 6 failed (Correct)." << std::endl;
+    }
+
+    // Test 4: Deletion by rank and by key
+    std::cout << "\n[Test 4: Deletion]" << std::endl;
+    int deleted_val;
+    myList.Delete(0, deleted_val);
+    std::cout << "Deleted element with rank 0. Value was: " << deleted_val << std::endl;
+    myList.DeleteElem(40);
+    std::cout << "Deleted element 40." << std::endl;
+    myList.Traverse();
+    bool delete_fail = myList.DeleteElem(99);
+    std::cout << "Attempt to delete missing element 99: " << (delete_fail ? "Success" : "Failed (Correct)") << std::endl;
+    delete_fail = myList.Delete(4, deleted_val);
+    std::cout << "Attempt to delete invalid rank 4: " << (delete_fail ? "Success" : "Failed (Correct)") << std::endl;
+
+    // Test 5: Randomized cross-check against a sorted std::vector
+    std::cout << "\n[Test 5: Randomized Cross-check]" << std::endl;
+    myList.ClearList();
+    std::vector<int> reference;
+    std::mt19937 rng(11);
+    bool consistent = true;
+    for (int step = 0; step < 50000 && consistent; ++step)
+    {
+        int op = static_cast<int>(rng() % 4);
+        int e = static_cast<int>(rng() % 2000);
+        if (op <= 1 || reference.empty())
+        {
+            myList.Insert(e);
+            reference.insert(std::upper_bound(reference.begin(), reference.end(), e), e);
+        }
+        else if (op == 2)
+        {
+            int i = static_cast<int>(rng() % reference.size());
+            consistent = myList.Delete(i, deleted_val) && deleted_val == reference[i];
+            reference.erase(reference.begin() + i);
+        }
+        else
+        {
+            auto it = std::lower_bound(reference.begin(), reference.end(), e);
+            bool present = it != reference.end() && *it == e;
+            int expected = present ? static_cast<int>(it - reference.begin()) : -1;
+            consistent = myList.LocateElem(e) == expected && myList.DeleteElem(e) == present;
+            if (present)
+                reference.erase(it);
+        }
+    }
+    for (int k = 0; consistent && k < static_cast<int>(reference.size()); ++k)
+    {
+        consistent = myList.GetElem(k, val) && val == reference[k];
+    }
+    consistent = consistent && myList.Length() == static_cast<int>(reference.size());
+    std::cout << "Contents match sorted std::vector after 50000 operations: " << (consistent ? "Yes (Correct)" : "No") << std::endl;
+
+    // Test 6: Clear List
+    std::cout << "\n[Test 6: Clear List]" << std::endl;
+    myList.ClearList();
+    std::cout << "Is list empty after clearing? " << (myList.IsEmpty() ? "Yes" : "No") << std::endl;
+    myList.Traverse();
+
+    std::cout << "\n--- Testbench Complete ---" << std::endl;
+    return 0;
+}
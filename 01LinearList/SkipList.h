@@ -0,0 +1,334 @@
+#ifndef SKIPLIST_H
+#define SKIPLIST_H
+
+#include <iostream>
+#include <new> // For ::operator new, placement new
+
+// Highest level a node may reach; 1/4 promotion probability covers 4^32 elements.
+const int SKIP_MAX_LEVEL = 32;
+
+/**
+ * Node of the skip list. Level 0 uses the C2LinkList layout: a circular,
+ * doubly linked ring through a header sentinel (link[0].next / prev).
+ * Higher levels only link forward. Each link records its span, the number of
+ * level-0 steps it skips, so ranks can be computed while searching.
+ * The links live in the same allocation, right after the node (see NewNode).
+ */
+struct SKIP_NODE
+{
+    int data;
+    SKIP_NODE *prev; // Level-0 predecessor (the header for the first node)
+    int level;       // Number of entries in link[]
+    struct Link
+    {
+        SKIP_NODE *next; // Next node on this level (the header at the end)
+        int span;        // Level-0 distance to 'next'
+    } *link;             // link[0..level-1], stored just past the node
+};
+
+/**
+ * @class SkipList
+ * @brief An indexable skip list holding ints in ascending order.
+ * Search, insert and delete by key or by rank take O(log n) expected time.
+ * Ranks are 0-based positions in the sorted order, as indices in C2LinkList.
+ * Duplicates are allowed; LocateElem reports the first one.
+ */
+class SkipList
+{
+private:
+    SKIP_NODE *header;   // Sentinel; rank -1, and also "past the end"
+    int level;           // Levels currently in use (>= 1)
+    int length;          // Number of elements
+    unsigned int seed;   // State of the xorshift generator for RandomLevel
+
+    static SKIP_NODE *NewNode(int level, int e);
+    int RandomLevel();
+    // Unlinks x, given update[l] = the last node before x on each level.
+    void Unlink(SKIP_NODE *x, SKIP_NODE **update);
+
+public:
+    // Constructor
+    SkipList();
+    // Destructor
+    ~SkipList();
+
+    // --- Basic Operations ---
+
+    void ClearList();
+    bool IsEmpty();
+    int Length();
+    void Traverse(); // A helper to print the list
+
+    // --- Core Data Operations ---
+
+    bool GetElem(int i, int &e);  // Element with rank i
+    int LocateElem(int e);        // Rank of the first e, -1 if absent
+    bool Insert(int e);           // Inserts e at its sorted position (no rank argument)
+    bool Delete(int i, int &e);   // Deletes the element with rank i
+    bool DeleteElem(int e);       // Deletes the first occurrence of e
+};
+
+// --- Function Implementations ---
+
+// NewNode: Allocates a node and its 'level' links in one block (links after the node).
+inline SKIP_NODE *SkipList::NewNode(int level, int e)
+{
+    static_assert(sizeof(SKIP_NODE) % alignof(SKIP_NODE::Link) == 0, "links must be aligned after the node");
+    void *mem = ::operator new(sizeof(SKIP_NODE) + level * sizeof(SKIP_NODE::Link));
+    SKIP_NODE *node = new (mem) SKIP_NODE;
+    node->data = e;
+    node->prev = nullptr;
+    node->level = level;
+    node->link = static_cast<SKIP_NODE::Link *>(static_cast<void *>(node + 1));
+    for (int l = 0; l < level; ++l)
+    {
+        new (node->link + l) SKIP_NODE::Link{nullptr, 0};
+    }
+    return node;
+}
+
+// Constructor: Initializes an empty list; every header link points back to itself.
+inline SkipList::SkipList()
+{
+    header = NewNode(SKIP_MAX_LEVEL, 0);
+    header->prev = header;
+    for (int l = 0; l < SKIP_MAX_LEVEL; ++l)
+    {
+        header->link[l].next = header;
+        header->link[l].span = 1;
+    }
+    level = 1;
+    length = 0;
+    seed = 2463534242u;
+}
+
+// Destructor: Cleans up all nodes and the header.
+inline SkipList::~SkipList()
+{
+    ClearList();
+    ::operator delete(header);
+}
+
+// ClearList: Deletes all nodes by walking level 0.
+inline void SkipList::ClearList()
+{
+    SKIP_NODE *current = header->link[0].next;
+    while (current != header)
+    {
+        SKIP_NODE *node_to_delete = current;
+        current = current->link[0].next;
+        ::operator delete(node_to_delete);
+    }
+    header->prev = header;
+    for (int l = 0; l < SKIP_MAX_LEVEL; ++l)
+    {
+        header->link[l].next = header;
+        header->link[l].span = 1;
+    }
+    level = 1;
+    length = 0;
+}
+
+// IsEmpty: Checks if the list is empty.
+inline bool SkipList::IsEmpty()
+{
+    return length == 0;
+}
+
+// Length: Returns the number of elements. O(1).
+inline int SkipList::Length()
+{
+    return length;
+}
+
+// Traverse: Prints the elements in order (level 0), with each node's height.
+inline void SkipList::Traverse()
+{
+    std::cout << "List contents: head -> ";
+    for (SKIP_NODE *p = header->link[0].next; p != header; p = p->link[0].next)
+    {
+        std::cout << p->data << "(" << p->level << ") <-> ";
+    }
+    std::cout << "head | Length: " << length << ", Levels: " << level << std::endl;
+}
+
+// RandomLevel: Each extra level is taken with probability 1/4.
+inline int SkipList::RandomLevel()
+{
+    int lvl = 1;
+    while (lvl < SKIP_MAX_LEVEL)
+    {
+        seed ^= seed << 13; // xorshift32
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        if ((seed & 3) != 0)
+            break;
+        lvl++;
+    }
+    return lvl;
+}
+
+// GetElem: Retrieves the element with rank i (0-based) by following spans.
+inline bool SkipList::GetElem(int i, int &e)
+{
+    if (i < 0 || i >= length)
+        return false; // Rank is out of bounds
+
+    int target = i + 1; // 1-based rank; the header has rank 0
+    int traversed = 0;
+    SKIP_NODE *x = header;
+    for (int l = level - 1; l >= 0; --l)
+    {
+        while (x->link[l].next != header && traversed + x->link[l].span <= target)
+        {
+            traversed += x->link[l].span;
+            x = x->link[l].next;
+        }
+        if (traversed == target)
+            break;
+    }
+    e = x->data;
+    return true;
+}
+
+// LocateElem: Returns the rank of the first occurrence of 'e', or -1.
+inline int SkipList::LocateElem(int e)
+{
+    int rank = 0;
+    SKIP_NODE *x = header;
+    for (int l = level - 1; l >= 0; --l)
+    {
+        while (x->link[l].next != header && x->link[l].next->data < e)
+        {
+            rank += x->link[l].span;
+            x = x->link[l].next;
+        }
+    }
+    x = x->link[0].next;
+    if (x != header && x->data == e)
+    {
+        return rank; // rank of x is rank + 1 (1-based), i.e. 'rank' 0-based
+    }
+    return -1; // Element not found
+}
+
+// Insert: Inserts 'e' after any equal elements, keeping the order ascending.
+inline bool SkipList::Insert(int e)
+{
+    SKIP_NODE *update[SKIP_MAX_LEVEL]; // Last node before e on each level
+    int rank[SKIP_MAX_LEVEL];          // 1-based rank of update[l]
+
+    SKIP_NODE *x = header;
+    for (int l = level - 1; l >= 0; --l)
+    {
+        rank[l] = (l == level - 1) ? 0 : rank[l + 1];
+        while (x->link[l].next != header && !(e < x->link[l].next->data))
+        {
+            rank[l] += x->link[l].span;
+            x = x->link[l].next;
+        }
+        update[l] = x;
+    }
+
+    int lvl = RandomLevel();
+    if (lvl > level)
+    {
+        for (int l = level; l < lvl; ++l)
+        {
+            rank[l] = 0;
+            update[l] = header;
+            header->link[l].span = length + 1; // Header to "past the end"
+        }
+        level = lvl;
+    }
+
+    x = NewNode(lvl, e);
+    for (int l = 0; l < lvl; ++l)
+    {
+        x->link[l].next = update[l]->link[l].next;
+        update[l]->link[l].next = x;
+        // Split the old span of update[l] between update[l] -> x -> next
+        x->link[l].span = update[l]->link[l].span - (rank[0] - rank[l]);
+        update[l]->link[l].span = (rank[0] - rank[l]) + 1;
+    }
+    for (int l = lvl; l < level; ++l)
+    {
+        update[l]->link[l].span++; // Higher links now jump over one more node
+    }
+
+    // Level 0 is doubly linked, as in C2LinkList
+    x->prev = update[0];
+    x->link[0].next->prev = x;
+    length++;
+    return true;
+}
+
+// Unlink: Removes x from every level and frees it.
+inline void SkipList::Unlink(SKIP_NODE *x, SKIP_NODE **update)
+{
+    for (int l = 0; l < level; ++l)
+    {
+        if (update[l]->link[l].next == x)
+        {
+            update[l]->link[l].span += x->link[l].span - 1;
+            update[l]->link[l].next = x->link[l].next;
+        }
+        else
+        {
+            update[l]->link[l].span--;
+        }
+    }
+    x->link[0].next->prev = x->prev;
+    while (level > 1 && header->link[level - 1].next == header)
+    {
+        level--;
+    }
+    length--;
+    ::operator delete(x);
+}
+
+// Delete: Deletes the element with rank i and returns it in 'e'.
+inline bool SkipList::Delete(int i, int &e)
+{
+    if (i < 0 || i >= length)
+        return false; // Invalid rank or empty list
+
+    SKIP_NODE *update[SKIP_MAX_LEVEL];
+    int traversed = 0;
+    SKIP_NODE *x = header;
+    for (int l = level - 1; l >= 0; --l)
+    {
+        while (x->link[l].next != header && traversed + x->link[l].span <= i)
+        {
+            traversed += x->link[l].span;
+            x = x->link[l].next;
+        }
+        update[l] = x;
+    }
+    x = x->link[0].next; // The node with 1-based rank i + 1
+    e = x->data;
+    Unlink(x, update);
+    return true;
+}
+
+// DeleteElem: Deletes the first occurrence of 'e'.
+inline bool SkipList::DeleteElem(int e)
+{
+    SKIP_NODE *update[SKIP_MAX_LEVEL];
+    SKIP_NODE *x = header;
+    for (int l = level - 1; l >= 0; --l)
+    {
+        while (x->link[l].next != header && x->link[l].next->data < e)
+        {
+            x = x->link[l].next;
+        }
+        update[l] = x;
+    }
+    x = x->link[0].next;
+    if (x == header || x->data != e)
+        return false; // Element not found
+    Unlink(x, update);
+    return true;
+}
+
+#endif // SKIPLIST_H
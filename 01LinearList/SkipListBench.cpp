@@ -0,0 +1,214 @@
+#include <iostream>
+#include <iomanip> // For std::setw
+#include <list>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm> // For std::sort
+#include <iterator>  // For std::next
+#include "C2LinkList.h"
+#include "SkipList.h"
+
+/**
+ * Benchmark: SkipList vs a sorted C2LinkList vs a sorted std::list.
+ * Each container starts with the same n sorted keys, then runs the same
+ * m operations of each kind: insert by key, search by key, get by rank and
+ * delete by key. The linear containers find positions by walking level 0,
+ * which is exactly the cost the skip list avoids.
+ */
+
+typedef std::chrono::steady_clock Clock;
+
+double ElapsedNs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// Ordered-sequence operations on a C2LinkList kept in ascending order.
+struct SortedC2
+{
+    C2LinkList<> list;
+
+    void Build(const std::vector<int> &sorted)
+    {
+        for (int k : sorted)
+            list.PushBack(k);
+    }
+    // Index of the first element >= e (Length() if none), walking from the head.
+    int LowerBound(int e)
+    {
+        int n = list.Length();
+        D_NODE *p = list.GetElemP(0);
+        int i = 0;
+        while (i < n && p->data < e)
+        {
+            p = p->next;
+            i++;
+        }
+        return i;
+    }
+    void Insert(int e) { list.Insert(LowerBound(e), e); }
+    int LocateElem(int e)
+    {
+        int i = LowerBound(e);
+        return (i < list.Length() && list.GetElemP(i)->data == e) ? i : -1;
+    }
+    int GetElem(int i) { return list.GetElemP(i)->data; }
+    bool DeleteElem(int e)
+    {
+        int i = LocateElem(e);
+        int deleted;
+        return i >= 0 && list.Delete(i, deleted);
+    }
+};
+
+// Ordered-sequence operations on a std::list kept in ascending order.
+struct SortedStdList
+{
+    std::list<int> list;
+
+    void Build(const std::vector<int> &sorted) { list.assign(sorted.begin(), sorted.end()); }
+    std::list<int>::iterator LowerBound(int e, int &i)
+    {
+        i = 0;
+        auto it = list.begin();
+        while (it != list.end() && *it < e)
+        {
+            ++it;
+            ++i;
+        }
+        return it;
+    }
+    void Insert(int e)
+    {
+        int i;
+        list.insert(LowerBound(e, i), e);
+    }
+    int LocateElem(int e)
+    {
+        int i;
+        auto it = LowerBound(e, i);
+        return (it != list.end() && *it == e) ? i : -1;
+    }
+    int GetElem(int i) { return *std::next(list.begin(), i); }
+    bool DeleteElem(int e)
+    {
+        int i;
+        auto it = LowerBound(e, i);
+        if (it == list.end() || *it != e)
+            return false;
+        list.erase(it);
+        return true;
+    }
+};
+
+// SkipList already has the ordered interface; adapt the two helpers.
+struct SkipAdapter
+{
+    SkipList list;
+
+    void Build(const std::vector<int> &sorted)
+    {
+        for (int k : sorted)
+            list.Insert(k);
+    }
+    void Insert(int e) { list.Insert(e); }
+    int LocateElem(int e) { return list.LocateElem(e); }
+    int GetElem(int i)
+    {
+        int e = 0;
+        list.GetElem(i, e);
+        return e;
+    }
+    bool DeleteElem(int e) { return list.DeleteElem(e); }
+};
+
+struct Result
+{
+    double insert_ns, search_ns, rank_ns, delete_ns; // per operation
+    long long checksum;
+};
+
+template <typename Seq>
+Result Run(Seq &seq, const std::vector<int> &sorted, const std::vector<int> &keys, const std::vector<int> &ranks)
+{
+    Result r;
+    r.checksum = 0;
+    seq.Build(sorted);
+
+    Clock::time_point start = Clock::now();
+    for (int k : keys)
+        seq.Insert(k);
+    r.insert_ns = ElapsedNs(start) / keys.size();
+
+    start = Clock::now();
+    for (int k : keys)
+        r.checksum += seq.LocateElem(k ^ 1); // Mix of hits and misses
+    r.search_ns = ElapsedNs(start) / keys.size();
+
+    start = Clock::now();
+    for (int i : ranks)
+        r.checksum += seq.GetElem(i);
+    r.rank_ns = ElapsedNs(start) / ranks.size();
+
+    start = Clock::now();
+    for (int k : keys)
+        r.checksum += seq.DeleteElem(k);
+    r.delete_ns = ElapsedNs(start) / keys.size();
+    return r;
+}
+
+void Print(const char *name, const Result &r)
+{
+    std::cout << std::setw(14) << name << std::fixed << std::setprecision(1)
+              << std::setw(14) << r.insert_ns << std::setw(14) << r.search_ns
+              << std::setw(14) << r.rank_ns << std::setw(14) << r.delete_ns << std::endl;
+}
+
+int main()
+{
+    std::cout << "--- SkipList / C2LinkList / std::list Benchmark ---" << std::endl;
+    std::mt19937 rng(2025);
+
+    for (int n = 1000; n <= 1000000; n *= 10)
+    {
+        // Linear containers pay O(n) per operation, so fewer operations on long lists.
+        int m = std::max(20, std::min(5000, 20000000 / n));
+        std::vector<int> sorted(n), keys(m), ranks(m);
+        for (int &k : sorted)
+            k = static_cast<int>(rng() % (4u * n));
+        std::sort(sorted.begin(), sorted.end());
+        for (int &k : keys)
+            k = static_cast<int>(rng() % (4u * n));
+        for (int &i : ranks)
+            i = static_cast<int>(rng() % n);
+
+        std::cout << "\nn = " << n << " (" << m << " operations of each kind, ns/op)" << std::endl;
+        std::cout << std::setw(14) << "container" << std::setw(14) << "insert" << std::setw(14) << "search"
+                  << std::setw(14) << "by rank" << std::setw(14) << "delete" << std::endl;
+
+        Result base;
+        {
+            SkipAdapter seq;
+            base = Run(seq, sorted, keys, ranks);
+            Print("SkipList", base);
+        }
+        {
+            SortedC2 seq;
+            Result r = Run(seq, sorted, keys, ranks);
+            Print("C2LinkList", r);
+            if (r.checksum != base.checksum)
+                std::cout << "Mismatch: C2LinkList disagrees with SkipList!" << std::endl;
+        }
+        {
+            SortedStdList seq;
+            Result r = Run(seq, sorted, keys, ranks);
+            Print("std::list", r);
+            if (r.checksum != base.checksum)
+                std::cout << "Mismatch: std::list disagrees with SkipList!" << std::endl;
+        }
+    }
+
+    std::cout << "\n--- Benchmark Complete ---" << std::endl;
+    return 0;
+}
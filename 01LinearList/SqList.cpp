@@ -1,123 +1,13 @@
 #include <iostream>
-
-const int LIST_MAX_SIZE = 100;
-
-class SqList
-{
-private:
-    int elem[LIST_MAX_SIZE]; // Storage for elements
-    int length;              // Current number of elements
-
-public:
-    SqList();
-    void ClearList();
-    bool IsEmpty();
-    int ListLength();
-    bool GetElem(int i, int &e);    // i: 0-based
-    int LocateElem(int e);          // 返回0-based下标，未找到返回-1
-    bool ListInsert(int i, int e);  // i: 0-based
-    bool ListDelete(int i, int &e); // i: 0-based
-    void ListTraverse();
-};
-
-// --- Function Implementations ---
-
-// Constructor: Initializes an empty list.
-SqList::SqList()
-{
-    length = 0;
-}
-
-// ClearList: Resets the list to be empty.
-void SqList::ClearList()
-{
-    length = 0;
-}
-
-// IsEmpty: Checks if the list is empty.
-bool SqList::IsEmpty()
-{
-    return length == 0;
-}
-
-// ListLength: Returns the current number of elements in the list.
-int SqList::ListLength()
-{
-    return length;
-}
-
-// GetElem: Retrieves the element at index i (0-based).
-bool SqList::GetElem(int i, int &e)
-{
-    if (i < 0 || i >= length)
-    {
-        return false; // Invalid index
-    }
-    e = elem[i];
-    return true;
-}
-
-// LocateElem: Finds the index of the first occurrence of element e (0-based).
-int SqList::LocateElem(int e)
-{
-    for (int i = 0; i < length; ++i)
-    {
-        if (elem[i] == e)
-        {
-            return i; // 0-based index
-        }
-    }
-    return -1; // Not found
-}
-
-// ListInsert: Inserts element e at index i (0-based).
-bool SqList::ListInsert(int i, int e)
-{
-    if (i < 0 || i > length || length >= LIST_MAX_SIZE)
-    {
-        return false; // Invalid index or list is full
-    }
-    for (int j = length; j > i; --j)
-    {
-        elem[j] = elem[j - 1]; // Shift elements to the right
-    }
-    elem[i] = e; // Insert new element
-    length++;
-    return true;
-}
-
-// ListDelete: Deletes the element at index i (0-based) and returns it in e.
-bool SqList::ListDelete(int i, int &e)
-{
-    if (i < 0 || i >= length)
-    {
-        return false; // Invalid index
-    }
-    e = elem[i];
-    for (int j = i; j < length - 1; ++j)
-    {
-        elem[j] = elem[j + 1]; // Shift elements to the left
-    }
-    length--;
-    return true;
-}
-
-// ListTraverse: Prints all elements in the list.
-void SqList::ListTraverse()
-{
-    for (int i = 0; i < length; ++i)
-    {
-        std::cout << elem[i] << " ";
-    }
-    std::cout << std::endl;
-}
+#include <string>
+#include "SqList.h"
 
 // --- Main function acting as a Testbench ---
 
 int main()
 {
     std::cout << "--- Initializing SqList Testbench ---" << std::endl;
-    SqList myList;
+    SqList<int> myList;
 
     // Test 1: Initial state
     std::cout << "\n[Test 1: Initial State]" << std::endl;
@@ -190,6 +80,62 @@ int main()
     delete_fail = myList.ListDelete(0, deleted_val);
     std::cout << "Attempt to delete from empty list: " << (delete_fail ? "Success" : "Failed (Correct)") << std::endl;
 
+    // Test 10: Growth beyond the old fixed size of 100
+    std::cout << "\n[Test 10: Growth]" << std::endl;
+    for (int k = 0; k < 1000; ++k)
+    {
+        myList.ListInsert(myList.ListLength(), k);
+    }
+    std::cout << "Length after 1000 appends: " << myList.ListLength() << ", capacity: " << myList.ListSize();
+    if (myList.GetElem(999, val))
+    {
+        std::cout << ", last element: " << val;
+    }
+    std::cout << std::endl;
+
+    // Test 11: Bulk insertion and deletion
+    std::cout << "\n[Test 11: InsertRange / DeleteRange]" << std::endl;
+    myList.DeleteRange(5, 990); // Keep 0..4 and 995..999
+    myList.ListTraverse();
+    int batch[] = {-1, -2, -3};
+    myList.InsertRange(5, batch, 3);
+    myList.ListTraverse();
+    bool range_fail = myList.DeleteRange(10, 5); // Only 13 elements left
+    std::cout << "Attempt to delete an out-of-range batch: " << (range_fail ? "Success" : "Failed (Correct)") << std::endl;
+
+    // Test 12: Reserve and ShrinkToFit
+    std::cout << "\n[Test 12: Reserve / ShrinkToFit]" << std::endl;
+    myList.ShrinkToFit();
+    std::cout << "Capacity after ShrinkToFit: " << myList.ListSize() << " (length " << myList.ListLength() << ")" << std::endl;
+    myList.Reserve(5000);
+    std::cout << "Capacity after Reserve(5000): " << myList.ListSize() << std::endl;
+
+    // Test 13: Non-trivially copyable element type
+    std::cout << "\n[Test 13: SqList<std::string>]" << std::endl;
+    SqList<std::string> words;
+    words.ListInsert(0, "world");
+    words.ListInsert(0, "hello");
+    std::string more[] = {"from", "the", "list"};
+    words.InsertRange(1, more, 3);
+    words.ListTraverse();
+    std::string removed;
+    words.ListDelete(2, removed);
+    std::cout << "Deleted \"" << removed << "\": ";
+    words.ListTraverse();
+    std::cout << "Located \"world\" at index " << words.LocateElem("world") << std::endl;
+
+    // Test 14: Sorted mode
+    std::cout << "\n[Test 14: Sorted Mode]" << std::endl;
+    SqList<int> sortedList;
+    int evens[] = {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20};
+    sortedList.InsertRange(0, evens, 11);
+    std::cout << "Enable sorted mode on ascending list: " << (sortedList.SetSorted(true) ? "Success (Correct)" : "Failed") << std::endl;
+    std::cout << "Locating 14 by binary search. Index: " << sortedList.LocateElem(14) << std::endl;
+    std::cout << "Locating 7 (not in list). Index: " << sortedList.LocateElem(7) << std::endl;
+    sortedList.ListInsert(4, 5); // Lands between 6 and 8, breaking the order
+    std::cout << "Sorted mode after out-of-order insert: " << (sortedList.IsSorted() ? "On" : "Off (Correct)") << std::endl;
+    std::cout << "Locating 5 by linear scan. Index: " << sortedList.LocateElem(5) << std::endl;
+
     std::cout << "\n--- Testbench Complete ---" << std::endl;
 
     return 0;
@@ -0,0 +1,591 @@
+#ifndef SQLIST_H
+#define SQLIST_H
+
+#include <iostream>
+#include <memory>      // For std::allocator, std::allocator_traits
+#include <cstring>     // For std::memcpy, std::memmove
+#include <type_traits> // For std::is_trivially_copyable
+#include <utility>     // For std::move, std::swap
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h> // SSE4.1 / AVX2 intrinsics
+#define SQLIST_X86_SIMD 1
+#endif
+
+// Initial capacity used by the first growth of an empty list.
+const int LIST_INIT_SIZE = 8;
+
+/******************************************************************************
+ * int search kernels used by SqList<int>::LocateElem
+ ******************************************************************************/
+
+// LocateIntScalar: Reference linear scan, one int per iteration.
+inline int LocateIntScalar(const int *a, int n, int e)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        if (a[i] == e)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#ifdef SQLIST_X86_SIMD
+// LocateIntSSE4: Compares 8 ints per iteration (two 128-bit registers).
+__attribute__((target("sse4.1"))) inline int LocateIntSSE4(const int *a, int n, int e)
+{
+    const __m128i key = _mm_set1_epi32(e);
+    int i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128i c0 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)), key);
+        __m128i c1 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i + 4)), key);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(c0)) | (_mm_movemask_ps(_mm_castsi128_ps(c1)) << 4);
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask); // Lowest set bit = first match
+        }
+    }
+    int tail = LocateIntScalar(a + i, n - i, e);
+    return tail < 0 ? -1 : i + tail;
+}
+
+// LocateIntAVX2: Compares 16 ints per iteration (two 256-bit registers).
+__attribute__((target("avx2"))) inline int LocateIntAVX2(const int *a, int n, int e)
+{
+    const __m256i key = _mm256_set1_epi32(e);
+    int i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m256i c0 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)), key);
+        __m256i c1 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i + 8)), key);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(c0)) | (_mm256_movemask_ps(_mm256_castsi256_ps(c1)) << 8);
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    int tail = LocateIntSSE4(a + i, n - i, e);
+    return tail < 0 ? -1 : i + tail;
+}
+#endif
+
+typedef int (*LocateIntFn)(const int *, int, int);
+
+// SelectLocateInt: Picks the widest kernel the running CPU supports.
+inline LocateIntFn SelectLocateInt()
+{
+#ifdef SQLIST_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return LocateIntAVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1"))
+    {
+        return LocateIntSSE4;
+    }
+#endif
+    return LocateIntScalar;
+}
+
+// LocateInt: Dispatches to the kernel chosen once, on first use.
+inline int LocateInt(const int *a, int n, int e)
+{
+    static const LocateIntFn kernel = SelectLocateInt();
+    return kernel(a, n, e);
+}
+
+/**
+ * @class SqList
+ * @brief A heap-backed sequential list whose storage grows geometrically.
+ * Appending is amortized O(1); InsertRange/DeleteRange shift the tail once per
+ * batch instead of once per element. Trivially copyable element types are
+ * relocated with memcpy/memmove, everything else is moved element by element.
+ *
+ * LocateElem scans with SSE4.1/AVX2 for SqList<int>. In the opt-in sorted mode
+ * (SetSorted) it uses a branchless binary search instead; the mode switches
+ * itself off as soon as an insertion breaks the ascending order.
+ */
+template <typename T, typename Alloc = std::allocator<T>>
+class SqList
+{
+private:
+    using AllocTraits = std::allocator_traits<Alloc>;
+    static constexpr bool kTrivial = std::is_trivially_copyable<T>::value;
+
+    T *elem;      // Storage for elements
+    int length;   // Current number of elements
+    int listsize; // Number of slots currently allocated
+    Alloc alloc;  // Allocator used for elem[]
+    bool sorted;  // Sorted mode: elem[] is ascending and LocateElem binary-searches
+
+    void Reallocate(int new_size);  // Moves the elements into a buffer of new_size slots
+    bool Grow(int min_size);        // Geometric growth up to at least min_size slots
+    void OpenGap(int i, int n);     // Shifts elem[i..length) right by n (length is not updated)
+    void DestroyRange(int from, int to);
+    int BinarySearch(const T &e); // Branchless lower bound, valid in sorted mode
+
+public:
+    explicit SqList(const Alloc &a = Alloc());
+    SqList(const SqList &other);
+    SqList(SqList &&other) noexcept;
+    SqList &operator=(SqList other);
+    ~SqList();
+
+    void ClearList();
+    bool IsEmpty();
+    int ListLength();
+    int ListSize(); // Number of allocated slots (capacity)
+    bool GetElem(int i, T &e);          // i: 0-based
+    int LocateElem(const T &e);         // 返回0-based下标，未找到返回-1
+    bool ListInsert(int i, const T &e); // i: 0-based
+    bool ListDelete(int i, T &e);       // i: 0-based
+    void ListTraverse();
+
+    // --- Capacity and Bulk Operations ---
+
+    bool Reserve(int n);                         // Ensures room for n elements
+    void ShrinkToFit();                          // Releases unused slots
+    bool InsertRange(int i, const T *src, int n); // Inserts src[0..n) at i; src must not point into this list
+    bool DeleteRange(int i, int n);              // Deletes elements [i, i+n)
+
+    // --- Sorted Mode ---
+
+    bool SetSorted(bool on); // Fails if 'on' is requested for an unsorted list
+    bool IsSorted();
+};
+
+// --- Function Implementations ---
+
+// Constructor: Initializes an empty list without allocating.
+template <typename T, typename Alloc>
+SqList<T, Alloc>::SqList(const Alloc &a) : alloc(a)
+{
+    elem = nullptr;
+    length = 0;
+    listsize = 0;
+    sorted = false;
+}
+
+// Copy constructor: Allocates exactly enough room and copies every element.
+template <typename T, typename Alloc>
+SqList<T, Alloc>::SqList(const SqList &other)
+    : alloc(AllocTraits::select_on_container_copy_construction(other.alloc))
+{
+    elem = nullptr;
+    length = 0;
+    listsize = 0;
+    sorted = other.sorted;
+    if (other.length > 0)
+    {
+        Reallocate(other.length);
+        for (int i = 0; i < other.length; ++i)
+        {
+            AllocTraits::construct(alloc, elem + i, other.elem[i]);
+        }
+        length = other.length;
+    }
+}
+
+// Move constructor: Steals the buffer of 'other', leaving it empty.
+template <typename T, typename Alloc>
+SqList<T, Alloc>::SqList(SqList &&other) noexcept : alloc(std::move(other.alloc))
+{
+    elem = other.elem;
+    length = other.length;
+    listsize = other.listsize;
+    sorted = other.sorted;
+    other.elem = nullptr;
+    other.length = 0;
+    other.listsize = 0;
+}
+
+// Assignment (copy-and-swap).
+template <typename T, typename Alloc>
+SqList<T, Alloc> &SqList<T, Alloc>::operator=(SqList other)
+{
+    std::swap(elem, other.elem);
+    std::swap(length, other.length);
+    std::swap(listsize, other.listsize);
+    std::swap(alloc, other.alloc);
+    std::swap(sorted, other.sorted);
+    return *this;
+}
+
+// Destructor: Destroys the elements and returns the buffer to the allocator.
+template <typename T, typename Alloc>
+SqList<T, Alloc>::~SqList()
+{
+    DestroyRange(0, length);
+    if (elem != nullptr)
+    {
+        AllocTraits::deallocate(alloc, elem, listsize);
+    }
+}
+
+// DestroyRange: Runs destructors on elem[from..to). No-op for trivial types.
+template <typename T, typename Alloc>
+void SqList<T, Alloc>::DestroyRange(int from, int to)
+{
+    if (!std::is_trivially_destructible<T>::value)
+    {
+        for (int k = from; k < to; ++k)
+        {
+            AllocTraits::destroy(alloc, elem + k);
+        }
+    }
+}
+
+// Reallocate: Moves the current elements into a fresh buffer of new_size slots.
+template <typename T, typename Alloc>
+void SqList<T, Alloc>::Reallocate(int new_size)
+{
+    T *new_elem = new_size > 0 ? AllocTraits::allocate(alloc, new_size) : nullptr;
+    if (length > 0)
+    {
+        if (kTrivial)
+        {
+            std::memcpy(static_cast<void *>(new_elem), elem, sizeof(T) * length);
+        }
+        else
+        {
+            for (int k = 0; k < length; ++k)
+            {
+                AllocTraits::construct(alloc, new_elem + k, std::move(elem[k]));
+            }
+            DestroyRange(0, length);
+        }
+    }
+    if (elem != nullptr)
+    {
+        AllocTraits::deallocate(alloc, elem, listsize);
+    }
+    elem = new_elem;
+    listsize = new_size;
+}
+
+// Grow: Doubles the capacity (or more, if needed) so that min_size slots fit.
+// Returns false if min_size cannot be represented.
+template <typename T, typename Alloc>
+bool SqList<T, Alloc>::Grow(int min_size)
+{
+    if (min_size <= listsize)
+    {
+        return true;
+    }
+    if (min_size < 0)
+    {
+        return false; // Overflow of the int length
+    }
+    long long new_size = listsize > 0 ? 2LL * listsize : LIST_INIT_SIZE;
+    if (new_size < min_size)
+    {
+        new_size = min_size;
+    }
+    if (new_size > 0x7fffffff)
+    {
+        new_size = 0x7fffffff;
+    }
+    Reallocate(static_cast<int>(new_size));
+    return true;
+}
+
+// OpenGap: Shifts elem[i..length) right by n slots in a single pass.
+// Requires listsize >= length + n. The gap elem[i..i+n) is left holding
+// moved-from objects (inside the old length) or raw memory (beyond it).
+template <typename T, typename Alloc>
+void SqList<T, Alloc>::OpenGap(int i, int n)
+{
+    if (kTrivial)
+    {
+        std::memmove(static_cast<void *>(elem + i + n), elem + i, sizeof(T) * (length - i));
+        return;
+    }
+    for (int k = length - 1; k >= i; --k)
+    {
+        if (k + n >= length)
+        {
+            AllocTraits::construct(alloc, elem + k + n, std::move(elem[k]));
+        }
+        else
+        {
+            elem[k + n] = std::move(elem[k]);
+        }
+    }
+}
+
+// ClearList: Resets the list to be empty. The buffer is kept for reuse.
+template <typename T, typename Alloc>
+void SqList<T, Alloc>::ClearList()
+{
+    DestroyRange(0, length);
+    length = 0;
+}
+
+// IsEmpty: Checks if the list is empty.
+template <typename T, typename Alloc>
+bool SqList<T, Alloc>::IsEmpty()
+{
+    return length == 0;
+}
+
+// ListLength: Returns the current number of elements in the list.
+template <typename T, typename Alloc>
+int SqList<T, Alloc>::ListLength()
+{
+    return length;
+}
+
+// ListSize: Returns the number of allocated slots.
+template <typename T, typename Alloc>
+int SqList<T, Alloc>::ListSize()
+{
+    return listsize;
+}
+
+// GetElem: Retrieves the element at index i (0-based).
+template <typename T, typename Alloc>
+bool SqList<T, Alloc>::GetElem(int i, T &e)
+{
+    if (i < 0 || i >= length)
+    {
+        return false; // Invalid index
+    }
+    e = elem[i];
+    return true;
+}
+
+// LocateElem: Finds the index of the first occurrence of element e (0-based).
+// Sorted mode binary-searches; SqList<int> otherwise uses the SIMD kernels.
+template <typename T, typename Alloc>
+int SqList<T, Alloc>::LocateElem(const T &e)
+{
+    if (sorted)
+    {
+        return BinarySearch(e);
+    }
+    if constexpr (std::is_same<T, int>::value)
+    {
+        return LocateInt(elem, length, e);
+    }
+    for (int i = 0; i < length; ++i)
+    {
+        if (elem[i] == e)
+        {
+            return i; // 0-based index
+        }
+    }
+    return -1; // Not found
+}
+
+// BinarySearch: Branchless lower bound over the ascending elem[].
+// The loop body compiles to a conditional move, so there is no
+// unpredictable branch per level. Returns the first index holding e, or -1.
+template <typename T, typename Alloc>
+int SqList<T, Alloc>::BinarySearch(const T &e)
+{
+    if (length == 0)
+    {
+        return -1;
+    }
+    const T *base = elem;
+    int n = length;
+    while (n > 1)
+    {
+        int half = n / 2;
+        base = (base[half - 1] < e) ? base + half : base;
+        n -= half;
+    }
+    int i = static_cast<int>(base - elem) + (*base < e ? 1 : 0);
+    return (i < length && elem[i] == e) ? i : -1;
+}
+
+// ListInsert: Inserts element e at index i (0-based).
+// Appending (i == length) is amortized O(1) thanks to geometric growth.
+template <typename T, typename Alloc>
+bool SqList<T, Alloc>::ListInsert(int i, const T &e)
+{
+    if (i < 0 || i > length)
+    {
+        return false; // Invalid index
+    }
+    T value(e); // e may refer to an element of this list
+    if (sorted && ((i > 0 && value < elem[i - 1]) || (i < length && elem[i] < value)))
+    {
+        sorted = false; // The insertion breaks the ascending order
+    }
+    if (!Grow(length + 1))
+    {
+        return false; // List cannot grow any further
+    }
+    OpenGap(i, 1); // Shift elements to the right
+    if (i == length)
+    {
+        AllocTraits::construct(alloc, elem + i, std::move(value));
+    }
+    else
+    {
+        elem[i] = std::move(value); // Insert new element
+    }
+    length++;
+    return true;
+}
+
+// ListDelete: Deletes the element at index i (0-based) and returns it in e.
+template <typename T, typename Alloc>
+bool SqList<T, Alloc>::ListDelete(int i, T &e)
+{
+    if (i < 0 || i >= length)
+    {
+        return false; // Invalid index
+    }
+    e = std::move(elem[i]);
+    return DeleteRange(i, 1);
+}
+
+// ListTraverse: Prints all elements in the list.
+template <typename T, typename Alloc>
+void SqList<T, Alloc>::ListTraverse()
+{
+    for (int i = 0; i < length; ++i)
+    {
+        std::cout << elem[i] << " ";
+    }
+    std::cout << std::endl;
+}
+
+// Reserve: Makes sure at least n elements fit without further reallocation.
+template <typename T, typename Alloc>
+bool SqList<T, Alloc>::Reserve(int n)
+{
+    if (n < 0)
+    {
+        return false;
+    }
+    if (n > listsize)
+    {
+        Reallocate(n);
+    }
+    return true;
+}
+
+// ShrinkToFit: Reallocates the buffer down to exactly length slots.
+template <typename T, typename Alloc>
+void SqList<T, Alloc>::ShrinkToFit()
+{
+    if (listsize > length)
+    {
+        Reallocate(length);
+    }
+}
+
+// InsertRange: Inserts src[0..n) at index i (0-based).
+// The tail is shifted once for the whole batch, so the cost is O(length + n)
+// instead of O(length * n) for n separate ListInsert calls.
+template <typename T, typename Alloc>
+bool SqList<T, Alloc>::InsertRange(int i, const T *src, int n)
+{
+    if (i < 0 || i > length || n < 0 || (n > 0 && src == nullptr))
+    {
+        return false; // Invalid index or range
+    }
+    if (n == 0)
+    {
+        return true;
+    }
+    if (sorted)
+    {
+        bool keeps_order = !(i > 0 && src[0] < elem[i - 1]) && !(i < length && elem[i] < src[n - 1]);
+        for (int k = 1; keeps_order && k < n; ++k)
+        {
+            keeps_order = !(src[k] < src[k - 1]);
+        }
+        sorted = keeps_order;
+    }
+    if (!Grow(length + n))
+    {
+        return false;
+    }
+    OpenGap(i, n);
+    if (kTrivial)
+    {
+        std::memcpy(static_cast<void *>(elem + i), src, sizeof(T) * n);
+    }
+    else
+    {
+        for (int k = 0; k < n; ++k)
+        {
+            if (i + k < length)
+            {
+                elem[i + k] = src[k];
+            }
+            else
+            {
+                AllocTraits::construct(alloc, elem + i + k, src[k]);
+            }
+        }
+    }
+    length += n;
+    return true;
+}
+
+// DeleteRange: Deletes the n elements starting at index i (0-based).
+// The tail is shifted left once for the whole batch.
+template <typename T, typename Alloc>
+bool SqList<T, Alloc>::DeleteRange(int i, int n)
+{
+    if (i < 0 || n < 0 || i > length - n)
+    {
+        return false; // Invalid index or range
+    }
+    if (n == 0)
+    {
+        return true;
+    }
+    if (kTrivial)
+    {
+        std::memmove(static_cast<void *>(elem + i), elem + i + n, sizeof(T) * (length - i - n));
+    }
+    else
+    {
+        for (int k = i; k + n < length; ++k)
+        {
+            elem[k] = std::move(elem[k + n]); // Shift elements to the left
+        }
+        DestroyRange(length - n, length);
+    }
+    length -= n;
+    return true;
+}
+
+
+// SetSorted: Turns sorted mode on or off. Turning it on checks the order once
+// in O(n) and fails if the list is not ascending.
+template <typename T, typename Alloc>
+bool SqList<T, Alloc>::SetSorted(bool on)
+{
+    if (on)
+    {
+        for (int k = 1; k < length; ++k)
+        {
+            if (elem[k] < elem[k - 1])
+            {
+                return false;
+            }
+        }
+    }
+    sorted = on;
+    return true;
+}
+
+// IsSorted: Reports whether sorted mode is currently active.
+template <typename T, typename Alloc>
+bool SqList<T, Alloc>::IsSorted()
+{
+    return sorted;
+}
+
+#endif // SQLIST_H
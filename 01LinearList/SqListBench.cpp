@@ -0,0 +1,125 @@
+#include <iostream>
+#include <iomanip> // For std::setw
+#include <vector>
+#include <random>
+#include <chrono>
+#include "SqList.h"
+
+/**
+ * Benchmark for SqList<int>::LocateElem.
+ * Compares the scalar scan, the SSE4.1 and AVX2 kernels, the runtime-dispatched
+ * LocateElem and the sorted-mode binary search on lists of growing length.
+ * Every kernel must agree on every query; mismatches are reported.
+ */
+
+typedef int (*SearchFn)(SqList<int> &list, const int *a, int n, int e);
+
+int ScalarSearch(SqList<int> &, const int *a, int n, int e) { return LocateIntScalar(a, n, e); }
+#ifdef SQLIST_X86_SIMD
+int SSE4Search(SqList<int> &, const int *a, int n, int e) { return LocateIntSSE4(a, n, e); }
+int AVX2Search(SqList<int> &, const int *a, int n, int e) { return LocateIntAVX2(a, n, e); }
+#endif
+int ListSearch(SqList<int> &list, const int *, int, int e) { return list.LocateElem(e); }
+
+// TimeQueries: Runs every query once and returns the average ns per query.
+// 'checksum' accumulates the results so the calls cannot be optimized away.
+double TimeQueries(SearchFn fn, SqList<int> &list, const int *a, int n,
+                   const std::vector<int> &queries, long long &checksum)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int q : queries)
+    {
+        checksum += fn(list, a, n, q);
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / queries.size();
+}
+
+int main()
+{
+    std::cout << "--- SqList LocateElem Benchmark ---" << std::endl;
+    std::cout << "Dispatched kernel: ";
+    LocateIntFn chosen = SelectLocateInt();
+#ifdef SQLIST_X86_SIMD
+    std::cout << (chosen == LocateIntAVX2 ? "AVX2" : chosen == LocateIntSSE4 ? "SSE4.1" : "scalar") << std::endl;
+    bool has_sse4 = __builtin_cpu_supports("sse4.1");
+    bool has_avx2 = __builtin_cpu_supports("avx2");
+#else
+    std::cout << "scalar" << std::endl;
+#endif
+    (void)chosen;
+
+    std::mt19937 rng(2025);
+    const int sizes[] = {1000, 10000, 100000, 1000000};
+    std::cout << "\n"
+              << std::setw(10) << "n" << std::setw(12) << "scalar" << std::setw(12) << "sse4.1"
+              << std::setw(12) << "avx2" << std::setw(12) << "dispatch" << std::setw(12) << "sorted"
+              << "   (ns per query)" << std::endl;
+
+    for (int n : sizes)
+    {
+        // Ascending even numbers, so odd queries miss and sorted mode is valid.
+        std::vector<int> values(n);
+        for (int k = 0; k < n; ++k)
+        {
+            values[k] = 2 * k;
+        }
+        SqList<int> list;
+        list.InsertRange(0, values.data(), n);
+        const int *a = values.data();
+
+        // Half hits, half misses; fewer queries for long lists keep the run short.
+        int query_count = n >= 100000 ? 2000 : 20000;
+        std::vector<int> queries(query_count);
+        std::uniform_int_distribution<int> pick(0, 2 * n - 1);
+        for (int &q : queries)
+        {
+            q = pick(rng);
+        }
+
+        long long expected = 0, checksum = 0;
+        double t_scalar = TimeQueries(ScalarSearch, list, a, n, queries, expected);
+        double t_sse4 = -1, t_avx2 = -1;
+#ifdef SQLIST_X86_SIMD
+        if (has_sse4)
+        {
+            checksum = 0;
+            t_sse4 = TimeQueries(SSE4Search, list, a, n, queries, checksum);
+            if (checksum != expected)
+                std::cout << "Mismatch: sse4.1 kernel disagrees with scalar scan!" << std::endl;
+        }
+        if (has_avx2)
+        {
+            checksum = 0;
+            t_avx2 = TimeQueries(AVX2Search, list, a, n, queries, checksum);
+            if (checksum != expected)
+                std::cout << "Mismatch: avx2 kernel disagrees with scalar scan!" << std::endl;
+        }
+#endif
+        checksum = 0;
+        double t_dispatch = TimeQueries(ListSearch, list, a, n, queries, checksum);
+        if (checksum != expected)
+            std::cout << "Mismatch: LocateElem disagrees with scalar scan!" << std::endl;
+
+        list.SetSorted(true);
+        checksum = 0;
+        double t_sorted = TimeQueries(ListSearch, list, a, n, queries, checksum);
+        if (checksum != expected)
+            std::cout << "Mismatch: sorted mode disagrees with scalar scan!" << std::endl;
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(10) << n << std::setw(12) << t_scalar;
+        if (t_sse4 < 0)
+            std::cout << std::setw(12) << "n/a";
+        else
+            std::cout << std::setw(12) << t_sse4;
+        if (t_avx2 < 0)
+            std::cout << std::setw(12) << "n/a";
+        else
+            std::cout << std::setw(12) << t_avx2;
+        std::cout << std::setw(12) << t_dispatch << std::setw(12) << t_sorted << std::endl;
+    }
+
+    std::cout << "\n--- Benchmark Complete ---" << std::endl;
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include "UnrolledLinkList.h"
+
+// --- Main function acting as a Testbench ---
+
+int main()
+{
+    std::cout << "--- Initializing UnrolledLinkList Testbench ---" << std::endl;
+    UnrolledLinkList myList;
+
+    // Test 1: Initial state
+    std::cout << "\n[Test 1: Initial State]" << std::endl;
+    std::cout << "Is list empty? " << (myList.IsEmpty() ? "Yes" : "No") << std::endl;
+    std::cout << "Initial length: " << myList.Length() << std::endl;
+    myList.Traverse();
+
+    // Test 2: Insertion
+    std::cout << "\n[Test 2: Insertion]" << std::endl;
+    myList.Insert(0, 10); // Insert at beginning of empty list
+    myList.Insert(1, 30); // Insert at end
+    myList.Insert(1, 20); // Insert in middle
+    myList.Insert(0, 5);  // Insert at head of non-empty list
+    myList.Traverse();
+
+    // Test 3: Edge Case Insertion
+    std::cout << "\n[Test 3: Edge Case Insertion]" << std::endl;
+    bool insert_fail = myList.Insert(10, 99); // Invalid index
+    std::cout << "Attempt to insert at invalid index 10: " << (insert_fail ? "Success" : "Failed (Correct)") << std::endl;
+
+    // Test 4: Get and Locate Element
+    std::cout << "\n[Test 4: Get and Locate Element]" << std::endl;
+    int val;
+    if (myList.GetElem(2, val))
+    {
+        std::cout << "Element at index 2 is: " << val << std::endl;
+    }
+    if (!myList.GetElem(5, val))
+    {
+        std::cout << "Attempt to get element at invalid index 5 failed (Correct)." << std::endl;
+    }
+    std::cout << "Locating element 30. Index: " << myList.LocateElem(30) << std::endl;
+    std::cout << "Locating element 99 (not in list). Index: " << myList.LocateElem(99) << std::endl;
+
+    // Test 5: Splitting full blocks
+    std::cout << "\n[Test 5: Block Split]" << std::endl;
+    myList.ClearList();
+    for (int k = 0; k < UNROLLED_BLOCK_SIZE; ++k)
+    {
+        myList.Insert(k, k); // Fills exactly one block
+    }
+    myList.Insert(UNROLLED_BLOCK_SIZE / 2, -1); // Forces a split in the middle
+    if (myList.GetElem(UNROLLED_BLOCK_SIZE / 2, val))
+    {
+        std::cout << "Element at index " << UNROLLED_BLOCK_SIZE / 2 << " after split: " << val
+                  << " | Length: " << myList.Length() << std::endl;
+    }
+
+    // Test 6: Deletion and merging
+    std::cout << "\n[Test 6: Deletion / Merge]" << std::endl;
+    int deleted_val;
+    while (myList.Length() > 5)
+    {
+        myList.Delete(1, deleted_val); // Drains the first block until it merges
+    }
+    myList.Traverse();
+    bool delete_fail = myList.Delete(5, deleted_val);
+    std::cout << "Attempt to delete at invalid index 5: " << (delete_fail ? "Success" : "Failed (Correct)") << std::endl;
+
+    // Test 7: Randomized cross-check against std::vector
+    std::cout << "\n[Test 7: Randomized Cross-check]" << std::endl;
+    myList.ClearList();
+    std::vector<int> reference;
+    std::mt19937 rng(7);
+    bool consistent = true;
+    for (int step = 0; step < 20000 && consistent; ++step)
+    {
+        int n = static_cast<int>(reference.size());
+        if (n == 0 || rng() % 3 != 0)
+        {
+            int i = static_cast<int>(rng() % (n + 1));
+            int e = static_cast<int>(rng() % 1000);
+            myList.Insert(i, e);
+            reference.insert(reference.begin() + i, e);
+        }
+        else
+        {
+            int i = static_cast<int>(rng() % n);
+            myList.Delete(i, deleted_val);
+            consistent = deleted_val == reference[i];
+            reference.erase(reference.begin() + i);
+        }
+    }
+    for (int k = 0; consistent && k < static_cast<int>(reference.size()); ++k)
+    {
+        consistent = myList.GetElem(k, val) && val == reference[k];
+    }
+    consistent = consistent && myList.Length() == static_cast<int>(reference.size());
+    std::cout << "Contents match std::vector after 20000 operations: " << (consistent ? "Yes (Correct)" : "No") << std::endl;
+
+    // Test 8: Clear List
+    std::cout << "\n[Test 8: Clear List]" << std::endl;
+    myList.ClearList();
+    std::cout << "Is list empty after clearing? " << (myList.IsEmpty() ? "Yes" : "No") << std::endl;
+    myList.Traverse();
+    delete_fail = myList.Delete(0, deleted_val);
+    std::cout << "Attempt to delete from empty list: " << (delete_fail ? "Success" : "Failed (Correct)") << std::endl;
+
+    std::cout << "\n--- Testbench Complete ---" << std::endl;
+    return 0;
+}
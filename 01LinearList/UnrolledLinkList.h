@@ -0,0 +1,313 @@
+#ifndef UNROLLEDLINKLIST_H
+#define UNROLLEDLINKLIST_H
+
+#include <iostream>
+
+// Number of elements stored in one block of the unrolled list.
+// 64 ints fill four 64-byte cache lines.
+const int UNROLLED_BLOCK_SIZE = 64;
+
+// Block structure for the Unrolled Linked List
+struct U_BLOCK
+{
+    int count;                     // Elements in use: data[0..count)
+    int data[UNROLLED_BLOCK_SIZE]; // Elements, kept contiguous
+    U_BLOCK *next;
+};
+
+/**
+ * @class UnrolledLinkList
+ * @brief A singly linked list of blocks, each holding up to UNROLLED_BLOCK_SIZE ints.
+ * Same interface as LinkList. A scan touches one next pointer per block
+ * instead of one per element. A full block is split in half on insert, and a
+ * block that falls below a quarter full after a delete is merged into its
+ * successor (or refilled from it when both do not fit in one block).
+ */
+class UnrolledLinkList
+{
+private:
+    U_BLOCK *head; // First block (nullptr when the list is empty)
+    U_BLOCK *tail; // Last block, for O(1) append
+    int length;    // Total number of elements
+
+    // Finds the block holding position i and the offset of i inside it.
+    // With i == length it returns the tail block and its count (append slot).
+    U_BLOCK *FindBlock(int i, int &offset);
+    U_BLOCK *NewBlock(U_BLOCK *next);
+
+public:
+    // Constructor
+    UnrolledLinkList();
+    // Destructor
+    ~UnrolledLinkList();
+
+    // --- Basic Operations ---
+
+    void ClearList();
+    bool IsEmpty();
+    int Length();
+    void Traverse(); // A helper to print the list
+
+    // --- Core Data Operations ---
+
+    bool GetElem(int i, int &e);
+    int LocateElem(int e);
+    bool Insert(int i, int e);
+    bool Delete(int i, int &e);
+};
+
+// --- Function Implementations ---
+
+// Constructor: Initializes an empty list.
+inline UnrolledLinkList::UnrolledLinkList()
+{
+    head = nullptr;
+    tail = nullptr;
+    length = 0;
+}
+
+// Destructor: Cleans up all dynamically allocated blocks.
+inline UnrolledLinkList::~UnrolledLinkList()
+{
+    ClearList();
+}
+
+// ClearList: Deletes all blocks, freeing their memory.
+inline void UnrolledLinkList::ClearList()
+{
+    U_BLOCK *current = head;
+    while (current != nullptr)
+    {
+        U_BLOCK *block_to_delete = current;
+        current = current->next;
+        delete block_to_delete;
+    }
+    head = nullptr;
+    tail = nullptr;
+    length = 0;
+}
+
+// IsEmpty: Checks if the list is empty.
+inline bool UnrolledLinkList::IsEmpty()
+{
+    return length == 0;
+}
+
+// Length: Returns the number of elements. O(1).
+inline int UnrolledLinkList::Length()
+{
+    return length;
+}
+
+// Traverse: A utility function to print the contents of the list.
+// Blocks are separated by '|'.
+inline void UnrolledLinkList::Traverse()
+{
+    std::cout << "List contents: head -> ";
+    U_BLOCK *current = head;
+    while (current != nullptr)
+    {
+        std::cout << "[ ";
+        for (int k = 0; k < current->count; ++k)
+        {
+            std::cout << current->data[k] << " ";
+        }
+        std::cout << "] -> ";
+        current = current->next;
+    }
+    std::cout << "nullptr | Length: " << length << std::endl;
+}
+
+// NewBlock: Allocates an empty block that links to 'next'.
+inline U_BLOCK *UnrolledLinkList::NewBlock(U_BLOCK *next)
+{
+    U_BLOCK *block = new U_BLOCK;
+    block->count = 0;
+    block->next = next;
+    return block;
+}
+
+// FindBlock: Skips whole blocks until the one containing position i.
+inline U_BLOCK *UnrolledLinkList::FindBlock(int i, int &offset)
+{
+    if (i == length)
+    {
+        offset = tail->count;
+        return tail;
+    }
+    U_BLOCK *p = head;
+    while (i >= p->count)
+    {
+        i -= p->count;
+        p = p->next;
+    }
+    offset = i;
+    return p;
+}
+
+// GetElem: Retrieves the element at a specific position 'i' (0-based).
+inline bool UnrolledLinkList::GetElem(int i, int &e)
+{
+    if (i < 0 || i >= length)
+        return false; // Index is out of bounds
+
+    int offset;
+    U_BLOCK *p = FindBlock(i, offset);
+    e = p->data[offset];
+    return true;
+}
+
+// LocateElem: Returns the index of the first occurrence of element 'e'.
+// The inner loop runs over a contiguous array and can be vectorized.
+inline int UnrolledLinkList::LocateElem(int e)
+{
+    int base = 0;
+    for (U_BLOCK *p = head; p != nullptr; p = p->next)
+    {
+        for (int k = 0; k < p->count; ++k)
+        {
+            if (p->data[k] == e)
+            {
+                return base + k;
+            }
+        }
+        base += p->count;
+    }
+    return -1; // Element not found
+}
+
+// Insert: Inserts element 'e' at position 'i'.
+inline bool UnrolledLinkList::Insert(int i, int e)
+{
+    if (i < 0 || i > length)
+        return false; // Invalid index
+
+    // Case 1: The list is empty
+    if (head == nullptr)
+    {
+        head = tail = NewBlock(nullptr);
+    }
+
+    int offset;
+    U_BLOCK *p = FindBlock(i, offset);
+
+    // Case 2: Appending to a full block, start a new one after it
+    // (keeps blocks full when the list is built front to back)
+    if (offset == UNROLLED_BLOCK_SIZE)
+    {
+        U_BLOCK *q = NewBlock(p->next);
+        p->next = q;
+        if (tail == p)
+        {
+            tail = q;
+        }
+        p = q;
+        offset = 0;
+    }
+
+    // Case 3: The block is full, split it in half first
+    if (p->count == UNROLLED_BLOCK_SIZE)
+    {
+        const int half = UNROLLED_BLOCK_SIZE / 2;
+        U_BLOCK *q = NewBlock(p->next);
+        for (int k = half; k < UNROLLED_BLOCK_SIZE; ++k)
+        {
+            q->data[k - half] = p->data[k];
+        }
+        q->count = UNROLLED_BLOCK_SIZE - half;
+        p->count = half;
+        p->next = q;
+        if (tail == p)
+        {
+            tail = q;
+        }
+        if (offset > half)
+        {
+            p = q;
+            offset -= half;
+        }
+    }
+
+    // Shift the rest of the block right and insert
+    for (int k = p->count; k > offset; --k)
+    {
+        p->data[k] = p->data[k - 1];
+    }
+    p->data[offset] = e;
+    p->count++;
+    length++;
+    return true;
+}
+
+// Delete: Deletes the element at position 'i'.
+inline bool UnrolledLinkList::Delete(int i, int &e)
+{
+    if (i < 0 || i >= length)
+        return false; // Invalid index or empty list
+
+    // Find the block and its predecessor (needed to unlink an empty block)
+    U_BLOCK *prev = nullptr;
+    U_BLOCK *p = head;
+    while (i >= p->count)
+    {
+        i -= p->count;
+        prev = p;
+        p = p->next;
+    }
+
+    e = p->data[i];
+    for (int k = i; k < p->count - 1; ++k)
+    {
+        p->data[k] = p->data[k + 1]; // Shift the rest of the block left
+    }
+    p->count--;
+    length--;
+
+    // Case 1: The block became empty, unlink it
+    if (p->count == 0)
+    {
+        if (prev == nullptr)
+            head = p->next;
+        else
+            prev->next = p->next;
+        if (tail == p)
+            tail = prev;
+        delete p;
+        return true;
+    }
+
+    // Case 2: The block is under a quarter full, merge with or borrow from the next block
+    U_BLOCK *q = p->next;
+    if (p->count < UNROLLED_BLOCK_SIZE / 4 && q != nullptr)
+    {
+        if (p->count + q->count <= UNROLLED_BLOCK_SIZE)
+        {
+            for (int k = 0; k < q->count; ++k)
+            {
+                p->data[p->count + k] = q->data[k];
+            }
+            p->count += q->count;
+            p->next = q->next;
+            if (tail == q)
+                tail = p;
+            delete q;
+        }
+        else
+        {
+            int moved = (q->count - p->count) / 2; // Even out the two blocks
+            for (int k = 0; k < moved; ++k)
+            {
+                p->data[p->count + k] = q->data[k];
+            }
+            for (int k = moved; k < q->count; ++k)
+            {
+                q->data[k - moved] = q->data[k];
+            }
+            p->count += moved;
+            q->count -= moved;
+        }
+    }
+    return true;
+}
+
+#endif // UNROLLEDLINKLIST_H
@@ -0,0 +1,81 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "ConcurrentLinkedStack.h"
+
+// --- Main function acting as a Testbench ---
+
+int main()
+{
+    std::cout << "--- Initializing ConcurrentLinkedStack Testbench ---" << std::endl;
+    ConcurrentLinkedStack<int> myStack;
+
+    // Test 1: Initial state
+    std::cout << "\n[Test 1: Initial State]" << std::endl;
+    std::cout << "Is stack empty? " << (myStack.IsEmpty() ? "Yes" : "No") << std::endl;
+    std::cout << "Initial length: " << myStack.StackLength() << std::endl;
+
+    // Test 2: Push operation
+    std::cout << "\n[Test 2: Push Operation]" << std::endl;
+    std::cout << "Pushing 10, 20, 30..." << std::endl;
+    myStack.Push(10);
+    myStack.Push(20);
+    myStack.Push(30);
+    myStack.StackTraverse();
+    std::cout << "Current length: " << myStack.StackLength() << std::endl;
+
+    // Test 3: GetTop and Pop
+    std::cout << "\n[Test 3: GetTop / Pop Operation]" << std::endl;
+    int top_val = 0;
+    if (myStack.GetTop(top_val))
+    {
+        std::cout << "Top element is: " << top_val << std::endl;
+    }
+    int popped_val;
+    while (myStack.Pop(popped_val))
+    {
+        std::cout << "Popped value: " << popped_val << std::endl;
+    }
+    bool pop_fail = myStack.Pop(popped_val);
+    std::cout << "Attempt to Pop from empty stack: " << (!pop_fail ? "Failed (Correct)" : "Succeeded (Incorrect)") << std::endl;
+
+    // Test 4: Concurrent producers and consumers
+    std::cout << "\n[Test 4: Concurrent Push / Pop]" << std::endl;
+    const int kThreads = 8;
+    const int kPerThread = 100000;
+    std::vector<std::vector<char>> seen(kThreads, std::vector<char>(kPerThread, 0));
+    std::vector<long long> popped_count(kThreads, 0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        workers.emplace_back([&, t]() {
+            std::vector<int> mine;
+            for (int k = 0; k < kPerThread; ++k)
+            {
+                myStack.Push(t * kPerThread + k); // Unique value per push
+                int v;
+                if (k % 2 == 1 && myStack.Pop(v))
+                    mine.push_back(v);
+                if (k % 2 == 1 && myStack.Pop(v))
+                    mine.push_back(v);
+            }
+            for (int v : mine)
+                seen[v / kPerThread][v % kPerThread]++; // Distinct slots per value; checked after join
+            popped_count[t] = static_cast<long long>(mine.size());
+        });
+    }
+    for (std::thread &w : workers)
+        w.join();
+    while (myStack.Pop(popped_val))
+        seen[popped_val / kPerThread][popped_val % kPerThread]++;
+
+    bool exactly_once = true;
+    for (const std::vector<char> &row : seen)
+        for (char c : row)
+            exactly_once = exactly_once && c == 1;
+    std::cout << "Every pushed value popped exactly once: " << (exactly_once ? "Yes (Correct)" : "No") << std::endl;
+    std::cout << "Is stack empty afterwards? " << (myStack.IsEmpty() ? "Yes" : "No") << std::endl;
+
+    std::cout << "\n--- Testbench Complete ---" << std::endl;
+    return 0;
+}
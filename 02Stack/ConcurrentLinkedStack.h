@@ -0,0 +1,187 @@
+#ifndef CONCURRENTLINKEDSTACK_H
+#define CONCURRENTLINKEDSTACK_H
+
+#include <iostream>
+#include <atomic>
+#include <new>     // For std::nothrow
+#include <cstdint> // For std::uintptr_t
+#include "HazardPointer.h"
+
+/**
+ * @class ConcurrentLinkedStack
+ * @brief A lock-free linked stack (Treiber stack) that many threads can share.
+ * As in LinkedStack, the head of the linked list is the top of the stack.
+ * Push and Pop swing the top pointer with a compare-and-swap.
+ *
+ * The top pointer carries a 16-bit modification tag in its upper bits (user
+ * space addresses fit in 48 bits on x86-64 and AArch64), so a CAS fails if the
+ * top was popped and pushed back in between (ABA). Popped nodes are retired
+ * through hazard pointers and only freed once no thread can still be reading
+ * them.
+ */
+template <typename T>
+class ConcurrentLinkedStack
+{
+private:
+    struct Node
+    {
+        T data;
+        Node *next;
+        Node(const T &val) : data(val), next(nullptr) {}
+    };
+
+    static_assert(sizeof(void *) == 8, "ConcurrentLinkedStack packs a tag into 64-bit pointers");
+    static const int kTagShift = 48;
+    static const std::uintptr_t kPtrMask = (std::uintptr_t(1) << kTagShift) - 1;
+
+    static Node *Ptr(std::uintptr_t v) { return reinterpret_cast<Node *>(v & kPtrMask); }
+    static std::uintptr_t Tag(std::uintptr_t v) { return v >> kTagShift; }
+    static std::uintptr_t Pack(Node *p, std::uintptr_t tag)
+    {
+        return reinterpret_cast<std::uintptr_t>(p) | (tag << kTagShift);
+    }
+
+    alignas(64) std::atomic<std::uintptr_t> top; // Tagged pointer to the top node
+    alignas(64) std::atomic<int> count;          // Element count; a snapshot under concurrency
+
+public:
+    ConcurrentLinkedStack();
+    ~ConcurrentLinkedStack(); // Must not run concurrently with other calls
+
+    void ClearStack();
+    bool IsEmpty();
+    int StackLength();
+    bool GetTop(T &e);    // Copies the top element without popping
+    bool Push(const T &e); // Pushes an element onto the stack
+    bool Pop(T &e);        // Pops an element from the stack
+    void StackTraverse(); // Not thread-safe; for testing only
+};
+
+// --- Function Implementations ---
+
+// Constructor: Initializes an empty stack.
+template <typename T>
+ConcurrentLinkedStack<T>::ConcurrentLinkedStack()
+{
+    top.store(0);
+    count.store(0);
+}
+
+// Destructor: No other thread may use the stack any more, so the remaining
+// nodes are deleted directly.
+template <typename T>
+ConcurrentLinkedStack<T>::~ConcurrentLinkedStack()
+{
+    Node *current = Ptr(top.load());
+    while (current != nullptr)
+    {
+        Node *temp = current;
+        current = current->next;
+        delete temp;
+    }
+}
+
+// ClearStack: Pops until the stack is empty. Safe under concurrency.
+template <typename T>
+void ConcurrentLinkedStack<T>::ClearStack()
+{
+    T e;
+    while (Pop(e))
+    {
+    }
+}
+
+// IsEmpty: Checks if the stack is empty.
+template <typename T>
+bool ConcurrentLinkedStack<T>::IsEmpty()
+{
+    return Ptr(top.load()) == nullptr;
+}
+
+// StackLength: Returns the number of elements.
+template <typename T>
+int ConcurrentLinkedStack<T>::StackLength()
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+// GetTop: Copies the top element into 'e' without removing it.
+// The top node is protected by a hazard pointer while it is read.
+template <typename T>
+bool ConcurrentLinkedStack<T>::GetTop(T &e)
+{
+    HazardThread &hp = ThisHazardThread();
+    std::uintptr_t old_top = hp.Protect(0, top, [](std::uintptr_t v) { return static_cast<void *>(Ptr(v)); });
+    Node *node = Ptr(old_top);
+    if (node != nullptr)
+    {
+        e = node->data;
+    }
+    hp.Clear(0);
+    return node != nullptr;
+}
+
+// Push: Links a new node in front of the current top with a CAS loop.
+template <typename T>
+bool ConcurrentLinkedStack<T>::Push(const T &e)
+{
+    Node *newNode = new (std::nothrow) Node(e);
+    if (newNode == nullptr)
+    {
+        return false; // Memory allocation failed
+    }
+    std::uintptr_t old_top = top.load(std::memory_order_relaxed);
+    do
+    {
+        newNode->next = Ptr(old_top);
+    } while (!top.compare_exchange_weak(old_top, Pack(newNode, Tag(old_top) + 1),
+                                        std::memory_order_release, std::memory_order_relaxed));
+    count.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Pop: Protects the top node, then swings top to its successor with a CAS.
+// The unlinked node is retired instead of deleted.
+template <typename T>
+bool ConcurrentLinkedStack<T>::Pop(T &e)
+{
+    HazardThread &hp = ThisHazardThread();
+    Node *node;
+    while (true)
+    {
+        std::uintptr_t old_top = hp.Protect(0, top, [](std::uintptr_t v) { return static_cast<void *>(Ptr(v)); });
+        node = Ptr(old_top);
+        if (node == nullptr)
+        {
+            hp.Clear(0);
+            return false; // Stack is empty
+        }
+        // 'node' cannot be freed while protected, so reading next is safe
+        if (top.compare_exchange_strong(old_top, Pack(node->next, Tag(old_top) + 1),
+                                        std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+    hp.Clear(0);
+    e = node->data; // Copied, not moved: a concurrent GetTop may still be reading it
+    count.fetch_sub(1, std::memory_order_relaxed);
+    hp.Retire(node);
+    return true;
+}
+
+// StackTraverse: Prints all elements from top to bottom.
+template <typename T>
+void ConcurrentLinkedStack<T>::StackTraverse()
+{
+    std::cout << "Stack (top -> bottom): ";
+    Node *current = Ptr(top.load());
+    while (current != nullptr)
+    {
+        std::cout << current->data << " ";
+        current = current->next;
+    }
+    std::cout << std::endl;
+}
+
+#endif // CONCURRENTLINKEDSTACK_H
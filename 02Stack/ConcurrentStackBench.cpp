@@ -0,0 +1,97 @@
+#include <iostream>
+#include <iomanip> // For std::setw
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include "LinkedStack.h"
+#include "ConcurrentLinkedStack.h"
+
+/**
+ * Throughput benchmark: ConcurrentLinkedStack vs LinkedStack behind a mutex.
+ * Each thread runs push/pop pairs (a work-distribution loop) on one shared
+ * stack; the table reports total operations per second for 1 to 64 threads.
+ */
+
+const int kOpsPerRun = 2000000; // Push + pop operations across all threads
+
+// LinkedStack with every call serialized by one mutex.
+class MutexLinkedStack
+{
+private:
+    std::mutex lock;
+    LinkedStack<> stack;
+
+public:
+    bool Push(int e)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return stack.Push(e);
+    }
+    bool Pop(int &e)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return stack.Pop(e);
+    }
+};
+
+// Run: Starts 'threads' workers that together perform kOpsPerRun operations.
+// Returns operations per second; 'popped' counts successful pops.
+template <typename Stack>
+double Run(Stack &stack, int threads, long long &popped)
+{
+    std::atomic<bool> go(false);
+    std::atomic<long long> pops(0);
+    std::vector<std::thread> workers;
+    int pairs = kOpsPerRun / 2 / threads;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]() {
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            long long mine = 0;
+            int v;
+            for (int k = 0; k < pairs; ++k)
+            {
+                stack.Push(t + k);
+                mine += stack.Pop(v);
+            }
+            pops.fetch_add(mine);
+        });
+    }
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread &w : workers)
+        w.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    popped = pops.load();
+    return 2.0 * pairs * threads / seconds;
+}
+
+int main()
+{
+    std::cout << "--- ConcurrentLinkedStack Throughput Benchmark ---" << std::endl;
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << "\n"
+              << std::setw(8) << "threads" << std::setw(18) << "lock-free Mops/s"
+              << std::setw(18) << "mutex Mops/s" << std::endl;
+
+    for (int threads = 1; threads <= 64; threads *= 2)
+    {
+        long long popped_lf = 0, popped_mx = 0;
+        ConcurrentLinkedStack<int> lock_free;
+        double lf = Run(lock_free, threads, popped_lf);
+        MutexLinkedStack locked;
+        double mx = Run(locked, threads, popped_mx);
+
+        std::cout << std::fixed << std::setprecision(2) << std::setw(8) << threads
+                  << std::setw(18) << lf / 1e6 << std::setw(18) << mx / 1e6 << std::endl;
+        // Every pop follows the same thread's push, so none may fail.
+        if (popped_lf != kOpsPerRun / 2 / threads * threads || popped_mx != popped_lf)
+            std::cout << "Mismatch: a pop failed on a non-empty stack!" << std::endl;
+    }
+
+    std::cout << "\n--- Benchmark Complete ---" << std::endl;
+    return 0;
+}
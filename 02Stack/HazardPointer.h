@@ -0,0 +1,197 @@
+#ifndef HAZARDPOINTER_H
+#define HAZARDPOINTER_H
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm> // For std::sort, std::binary_search
+#include <stdexcept> // For std::runtime_error
+
+/**
+ * Hazard pointers for the lock-free containers (ConcurrentLinkedStack and
+ * ConcurrentLinkedQueue, the Michael-Scott queue in 03Queue).
+ *
+ * A thread publishes the node it is about to dereference in one of its
+ * hazard slots and then re-checks that the node is still reachable. A removed
+ * node is not freed right away but retired; it is freed by a later scan only
+ * when no slot holds it. This makes reading a popped node safe and also rules
+ * out ABA, since a node cannot be recycled while someone still points at it.
+ */
+
+const int HP_MAX_THREADS = 128;     // Threads that may use hazard pointers at the same time
+const int HP_SLOTS_PER_THREAD = 2;  // Hazard slots per thread
+const int HP_SCAN_THRESHOLD = 2 * HP_MAX_THREADS * HP_SLOTS_PER_THREAD; // Retired nodes before a scan
+
+// A retired node together with the function that frees it.
+struct RetiredNode
+{
+    void *ptr;
+    void (*deleter)(void *);
+};
+
+/**
+ * @class HazardDomain
+ * @brief Process-wide table of hazard slots, one row per registered thread.
+ */
+class HazardDomain
+{
+private:
+    struct alignas(64) Record // One cache line per thread to avoid false sharing
+    {
+        std::atomic<void *> slot[HP_SLOTS_PER_THREAD];
+        std::atomic<bool> in_use;
+    };
+
+    Record records[HP_MAX_THREADS];
+    std::mutex orphan_mutex;
+    std::vector<RetiredNode> orphans; // Still-protected nodes left by exited threads
+
+    HazardDomain()
+    {
+        for (Record &r : records)
+        {
+            for (std::atomic<void *> &s : r.slot)
+                s.store(nullptr);
+            r.in_use.store(false);
+        }
+    }
+
+public:
+    static HazardDomain &Instance()
+    {
+        static HazardDomain domain;
+        return domain;
+    }
+
+    // AcquireRecord: Claims a free row for the calling thread.
+    int AcquireRecord()
+    {
+        for (int id = 0; id < HP_MAX_THREADS; ++id)
+        {
+            bool expected = false;
+            if (!records[id].in_use.load(std::memory_order_relaxed) &&
+                records[id].in_use.compare_exchange_strong(expected, true))
+            {
+                return id;
+            }
+        }
+        throw std::runtime_error("Error: Too many threads using hazard pointers.");
+    }
+
+    void ReleaseRecord(int id)
+    {
+        for (std::atomic<void *> &s : records[id].slot)
+            s.store(nullptr);
+        records[id].in_use.store(false);
+    }
+
+    std::atomic<void *> &Slot(int id, int k)
+    {
+        return records[id].slot[k];
+    }
+
+    // Scan: Frees every node in 'retired' that no hazard slot protects.
+    // Protected nodes stay in the list for the next scan.
+    void Scan(std::vector<RetiredNode> &retired)
+    {
+        if (orphan_mutex.try_lock())
+        {
+            retired.insert(retired.end(), orphans.begin(), orphans.end());
+            orphans.clear();
+            orphan_mutex.unlock();
+        }
+
+        std::vector<void *> protected_ptrs;
+        for (Record &r : records)
+        {
+            for (std::atomic<void *> &s : r.slot)
+            {
+                void *p = s.load();
+                if (p != nullptr)
+                    protected_ptrs.push_back(p);
+            }
+        }
+        std::sort(protected_ptrs.begin(), protected_ptrs.end());
+
+        std::size_t kept = 0;
+        for (std::size_t k = 0; k < retired.size(); ++k)
+        {
+            if (std::binary_search(protected_ptrs.begin(), protected_ptrs.end(), retired[k].ptr))
+                retired[kept++] = retired[k];
+            else
+                retired[k].deleter(retired[k].ptr);
+        }
+        retired.resize(kept);
+    }
+
+    // Adopt: Takes over nodes a thread could not free before exiting.
+    void Adopt(std::vector<RetiredNode> &retired)
+    {
+        std::lock_guard<std::mutex> lock(orphan_mutex);
+        orphans.insert(orphans.end(), retired.begin(), retired.end());
+        retired.clear();
+    }
+};
+
+/**
+ * @class HazardThread
+ * @brief Per-thread hazard state: the thread's row and its retired nodes.
+ * Created on a thread's first use and cleaned up when the thread exits.
+ */
+class HazardThread
+{
+private:
+    int id;
+    std::vector<RetiredNode> retired;
+
+public:
+    HazardThread() : id(HazardDomain::Instance().AcquireRecord()) {}
+
+    ~HazardThread()
+    {
+        HazardDomain &domain = HazardDomain::Instance();
+        domain.ReleaseRecord(id);
+        domain.Scan(retired);
+        if (!retired.empty())
+            domain.Adopt(retired);
+    }
+
+    // Protect: Publishes src's current value in slot k and returns it once the
+    // published value is confirmed to still be current.
+    template <typename Ptr, typename Decode>
+    Ptr Protect(int k, const std::atomic<Ptr> &src, Decode decode)
+    {
+        std::atomic<void *> &slot = HazardDomain::Instance().Slot(id, k);
+        Ptr value = src.load();
+        while (true)
+        {
+            slot.store(decode(value));
+            Ptr again = src.load();
+            if (again == value)
+                return value;
+            value = again;
+        }
+    }
+
+    void Clear(int k)
+    {
+        HazardDomain::Instance().Slot(id, k).store(nullptr, std::memory_order_release);
+    }
+
+    template <typename Node>
+    void Retire(Node *node)
+    {
+        retired.push_back(RetiredNode{node, [](void *p) { delete static_cast<Node *>(p); }});
+        if (static_cast<int>(retired.size()) >= HP_SCAN_THRESHOLD)
+            HazardDomain::Instance().Scan(retired);
+    }
+};
+
+// ThisHazardThread: The calling thread's hazard state.
+inline HazardThread &ThisHazardThread()
+{
+    thread_local HazardThread state;
+    return state;
+}
+
+#endif // HAZARDPOINTER_H
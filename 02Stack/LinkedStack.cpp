@@ -1,146 +1,12 @@
 #include <iostream>
-
-/**
- * @class LinkedStack
- * @brief A linked list implementation of a stack.
- * This implementation is based on the "Linked Stack" concept from the slides.
- * The head of the linked list acts as the top of the stack.
- */
-
-class LinkedStack
-{
-private:
-    // Node structure for the linked list
-    struct Node
-    {
-        int data;
-        Node *next;
-        // Constructor for convenience
-        Node(int val, Node *link) : data(val), next(link) {}
-    };
-
-    Node *top; // Pointer to the top of the stack (head of the list)
-    int count; // Keeps track of the number of elements for an O(1) StackLength
-
-public:
-    LinkedStack();
-    ~LinkedStack(); // Destructor to prevent memory leaks
-
-    void ClearStack();
-    bool IsEmpty();
-    int StackLength();
-    bool GetTop(int &e);  // Retrieves the top element without popping
-    bool Push(int e);     // Pushes an element onto the stack
-    bool Pop(int &e);     // Pops an element from the stack
-    void StackTraverse(); // Displays the content of the stack for testing
-};
-
-// --- Function Implementations ---
-
-// Constructor: Initializes an empty stack.
-LinkedStack::LinkedStack()
-{
-    top = nullptr;
-    count = 0;
-}
-
-// Destructor: Deallocates all nodes in the stack.
-LinkedStack::~LinkedStack()
-{
-    ClearStack();
-}
-
-// ClearStack: Removes all elements from the stack, freeing memory.
-// The logic follows slide 21, repeatedly popping until empty.
-void LinkedStack::ClearStack()
-{
-    Node *current = top;
-    while (current != nullptr)
-    {
-        Node *temp = current;
-        current = current->next;
-        delete temp;
-    }
-    top = nullptr;
-    count = 0;
-}
-
-// IsEmpty: Checks if the stack is empty.
-// An empty stack is identified by a null head/top pointer.
-bool LinkedStack::IsEmpty()
-{
-    return top == nullptr;
-}
-
-// StackLength: Returns the current number of elements. O(1) complexity.
-int LinkedStack::StackLength()
-{
-    return count;
-}
-
-// GetTop: Retrieves the top element into 'e' without removing it.
-// Returns the item from the head node.
-bool LinkedStack::GetTop(int &e)
-{
-    if (IsEmpty())
-    {
-        return false; // Stack is empty
-    }
-    e = top->data;
-    return true;
-}
-
-// Push: Inserts element 'e' at the top of the stack (head of the list).
-// This operation has a time complexity of O(1).
-// The logic is equivalent to "head = new node(e, head)" from slide 19.
-bool LinkedStack::Push(int e)
-{
-    Node *newNode = new (std::nothrow) Node(e, top);
-    if (newNode == nullptr)
-    {
-        return false; // Memory allocation failed
-    }
-    top = newNode;
-    count++;
-    return true;
-}
-
-// Pop: Deletes the top element and returns it in 'e'.
-// This operation has a time complexity of O(1).
-// The logic follows the diagram and code on slide 18.
-bool LinkedStack::Pop(int &e)
-{
-    if (IsEmpty())
-    {
-        return false; // Stack is empty
-    }
-    e = top->data;
-    Node *temp = top;
-    top = top->next;
-    delete temp;
-    count--;
-    return true;
-}
-
-// StackTraverse: Prints all elements from top to bottom.
-void LinkedStack::StackTraverse()
-{
-    std::cout << "Stack (top -> bottom): ";
-    Node *current = top;
-    while (current != nullptr)
-    {
-        std::cout << current->data << " ";
-        current = current->next;
-    }
-    std::cout << std::endl;
-}
+#include "LinkedStack.h"
 
 // --- Main function acting as a Testbench ---
 
 int main()
 {
     std::cout << "--- Initializing LinkedStack Testbench ---" << std::endl;
-    LinkedStack myStack;
+    LinkedStack<> myStack;
 
     // Test 1: Initial state
     std::cout << "\n[Test 1: Initial State]" << std::endl;
@@ -205,6 +71,22 @@ int main()
     std::cout << "Is stack empty after clearing? " << (myStack.IsEmpty() ? "Yes" : "No") << std::endl;
     myStack.StackTraverse();
 
+    // Test 7: Pooled node allocation
+    std::cout << "\n[Test 7: LinkedStack<NodePool>]" << std::endl;
+    LinkedStack<NodePool> pooledStack;
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int k = 1; k <= 4; ++k)
+        {
+            pooledStack.Push(round * 10 + k);
+        }
+        pooledStack.Pop(popped_val); // Slot goes to the free list and is reused
+        pooledStack.Push(-1);
+        pooledStack.StackTraverse();
+        pooledStack.ClearStack(); // Whole slab returned at once
+    }
+    std::cout << "Is pooled stack empty after clearing? " << (pooledStack.IsEmpty() ? "Yes" : "No") << std::endl;
+
     std::cout << "\n--- Testbench Complete ---" << std::endl;
 
     return 0;
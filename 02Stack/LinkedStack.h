@@ -0,0 +1,164 @@
+#ifndef LINKEDSTACK_H
+#define LINKEDSTACK_H
+
+#include <iostream>
+#include <new> // For placement new
+#include "../01LinearList/NodePool.h"
+
+/**
+ * @class LinkedStack
+ * @brief A linked list implementation of a stack.
+ * This implementation is based on the "Linked Stack" concept from the slides.
+ * The head of the linked list acts as the top of the stack.
+ * NodeAlloc is the node allocation policy from NodePool.h: HeapNodeAlloc
+ * (default) allocates every node on the heap, NodePool reuses slabs of nodes.
+ */
+
+template <template <typename> class NodeAlloc = HeapNodeAlloc>
+class LinkedStack
+{
+private:
+    // Node structure for the linked list
+    struct Node
+    {
+        int data;
+        Node *next;
+        // Constructor for convenience
+        Node(int val, Node *link) : data(val), next(link) {}
+    };
+
+    Node *top;             // Pointer to the top of the stack (head of the list)
+    int count;             // Keeps track of the number of elements for an O(1) StackLength
+    NodeAlloc<Node> nodes; // Supplies and reclaims node storage
+
+public:
+    LinkedStack();
+    ~LinkedStack(); // Destructor to prevent memory leaks
+
+    void ClearStack();
+    bool IsEmpty();
+    int StackLength();
+    bool GetTop(int &e);  // Retrieves the top element without popping
+    bool Push(int e);     // Pushes an element onto the stack
+    bool Pop(int &e);     // Pops an element from the stack
+    void StackTraverse(); // Displays the content of the stack for testing
+};
+
+// --- Function Implementations ---
+
+// Constructor: Initializes an empty stack.
+template <template <typename> class NodeAlloc>
+LinkedStack<NodeAlloc>::LinkedStack()
+{
+    top = nullptr;
+    count = 0;
+}
+
+// Destructor: Deallocates all nodes in the stack.
+template <template <typename> class NodeAlloc>
+LinkedStack<NodeAlloc>::~LinkedStack()
+{
+    ClearStack();
+}
+
+// ClearStack: Removes all elements from the stack, freeing memory.
+// The logic follows slide 21, repeatedly popping until empty.
+// A pooling policy takes back all nodes at once instead.
+template <template <typename> class NodeAlloc>
+void LinkedStack<NodeAlloc>::ClearStack()
+{
+    if (NodeAlloc<Node>::kBulkRelease)
+    {
+        nodes.ReleaseAll();
+        top = nullptr;
+        count = 0;
+        return;
+    }
+    Node *current = top;
+    while (current != nullptr)
+    {
+        Node *temp = current;
+        current = current->next;
+        nodes.Deallocate(temp);
+    }
+    top = nullptr;
+    count = 0;
+}
+
+// IsEmpty: Checks if the stack is empty.
+// An empty stack is identified by a null head/top pointer.
+template <template <typename> class NodeAlloc>
+bool LinkedStack<NodeAlloc>::IsEmpty()
+{
+    return top == nullptr;
+}
+
+// StackLength: Returns the current number of elements. O(1) complexity.
+template <template <typename> class NodeAlloc>
+int LinkedStack<NodeAlloc>::StackLength()
+{
+    return count;
+}
+
+// GetTop: Retrieves the top element into 'e' without removing it.
+// Returns the item from the head node.
+template <template <typename> class NodeAlloc>
+bool LinkedStack<NodeAlloc>::GetTop(int &e)
+{
+    if (IsEmpty())
+    {
+        return false; // Stack is empty
+    }
+    e = top->data;
+    return true;
+}
+
+// Push: Inserts element 'e' at the top of the stack (head of the list).
+// This operation has a time complexity of O(1).
+// The logic is equivalent to "head = new node(e, head)" from slide 19.
+template <template <typename> class NodeAlloc>
+bool LinkedStack<NodeAlloc>::Push(int e)
+{
+    void *mem = nodes.Allocate();
+    if (mem == nullptr)
+    {
+        return false; // Memory allocation failed
+    }
+    top = new (mem) Node(e, top);
+    count++;
+    return true;
+}
+
+// Pop: Deletes the top element and returns it in 'e'.
+// This operation has a time complexity of O(1).
+// The logic follows the diagram and code on slide 18.
+template <template <typename> class NodeAlloc>
+bool LinkedStack<NodeAlloc>::Pop(int &e)
+{
+    if (IsEmpty())
+    {
+        return false; // Stack is empty
+    }
+    e = top->data;
+    Node *temp = top;
+    top = top->next;
+    nodes.Deallocate(temp);
+    count--;
+    return true;
+}
+
+// StackTraverse: Prints all elements from top to bottom.
+template <template <typename> class NodeAlloc>
+void LinkedStack<NodeAlloc>::StackTraverse()
+{
+    std::cout << "Stack (top -> bottom): ";
+    Node *current = top;
+    while (current != nullptr)
+    {
+        std::cout << current->data << " ";
+        current = current->next;
+    }
+    std::cout << std::endl;
+}
+
+#endif // LINKEDSTACK_H
@@ -1,107 +1,347 @@
 #include <iostream>
+#include <new>         // For ::operator new
+#include <cstring>     // For std::memcpy
+#include <memory>      // For std::uninitialized_copy
+#include <type_traits> // For std::is_trivially_copyable
+#include <utility>     // For std::move
 
-const int STACK_MAX_SIZE = 100;
+// Number of elements per segment. The stack grows by chaining another
+// segment, so existing elements are never copied and never move.
+const int STACK_SEGMENT_SIZE = 1024;
 
+/**
+ * @class SqStack
+ * @brief A sequential stack stored in a chain of fixed-size segments.
+ * There is no maximum size: when the top segment is full, Push continues in a
+ * new segment. Elements stay where they were written, so pointers to them
+ * remain valid until they are popped. One emptied segment is kept as a spare
+ * so a push/pop sequence at a segment boundary does not allocate every time.
+ * PushBulk/PopBulk move whole spans, with memcpy for trivially copyable T.
+ */
+template <typename T>
 class SqStack
 {
 private:
-    int data[STACK_MAX_SIZE]; // Storage for stack elements
-    int top_index;            // Represents the current length and next empty slot
+    struct Segment
+    {
+        T *data;       // STACK_SEGMENT_SIZE slots
+        Segment *prev; // Segment below (nullptr for the bottom one)
+        Segment *next; // Spare segment above, if any
+    };
+
+    Segment *bottom;  // First segment, allocated on construction
+    Segment *top_seg; // Segment holding the top element
+    int top_index;    // Elements in top_seg; the next empty slot
+    int length;       // Total number of elements
+
+    static const bool kTrivial = std::is_trivially_copyable<T>::value;
+
+    Segment *NewSegment(Segment *prev);
+    void FreeSegment(Segment *seg);
+    bool Advance();     // Moves to the segment above, allocating it if needed
+    void StepBack();    // Moves to the segment below after top_seg emptied
 
 public:
     SqStack();
+    ~SqStack();
+    SqStack(const SqStack &) = delete;
+    SqStack &operator=(const SqStack &) = delete;
+
     void ClearStack();
     bool IsEmpty();
     int StackLength();
-    bool GetTop(int &e);  // Retrieves the top element without popping
-    bool Push(int e);     // Pushes an element onto the stack
-    bool Pop(int &e);     // Pops an element from the stack
+    bool GetTop(T &e);    // Retrieves the top element without popping
+    bool Push(const T &e); // Pushes an element onto the stack
+    bool Pop(T &e);       // Pops an element from the stack
     void StackTraverse(); // Displays the content of the stack for testing
+
+    // --- Bulk Operations ---
+
+    bool PushBulk(const T *src, int n); // Pushes src[0..n), src[n-1] ends on top
+    bool PopBulk(T *dst, int n);        // Pops the top n into dst[0..n), bottom-to-top order
 };
 
 // --- Function Implementations ---
 
-// Constructor: Initializes an empty stack.
-SqStack::SqStack()
+// NewSegment: Allocates an empty segment on top of 'prev'.
+template <typename T>
+typename SqStack<T>::Segment *SqStack<T>::NewSegment(Segment *prev)
+{
+    void *mem = ::operator new(sizeof(T) * STACK_SEGMENT_SIZE, std::nothrow);
+    if (mem == nullptr)
+    {
+        return nullptr;
+    }
+    Segment *seg = new (std::nothrow) Segment;
+    if (seg == nullptr)
+    {
+        ::operator delete(mem);
+        return nullptr;
+    }
+    seg->data = static_cast<T *>(mem);
+    seg->prev = prev;
+    seg->next = nullptr;
+    return seg;
+}
+
+// FreeSegment: Releases a segment whose elements are already destroyed.
+template <typename T>
+void SqStack<T>::FreeSegment(Segment *seg)
+{
+    ::operator delete(seg->data);
+    delete seg;
+}
+
+// Constructor: Initializes an empty stack with one segment.
+template <typename T>
+SqStack<T>::SqStack()
+{
+    bottom = NewSegment(nullptr);
+    if (bottom == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    top_seg = bottom;
+    top_index = 0;
+    length = 0;
+}
+
+// Destructor: Destroys the elements and frees every segment.
+template <typename T>
+SqStack<T>::~SqStack()
+{
+    ClearStack();
+    FreeSegment(bottom);
+}
+
+// Advance: Makes the segment above top_seg current, reusing the spare.
+template <typename T>
+bool SqStack<T>::Advance()
 {
+    if (top_seg->next == nullptr)
+    {
+        top_seg->next = NewSegment(top_seg);
+        if (top_seg->next == nullptr)
+        {
+            return false; // Memory allocation failed
+        }
+    }
+    top_seg = top_seg->next;
     top_index = 0;
+    return true;
+}
+
+// StepBack: Called when top_seg has become empty. Keeps it as the spare and
+// frees any spare above it.
+template <typename T>
+void SqStack<T>::StepBack()
+{
+    if (top_seg->next != nullptr)
+    {
+        FreeSegment(top_seg->next);
+        top_seg->next = nullptr;
+    }
+    top_seg = top_seg->prev;
+    top_index = STACK_SEGMENT_SIZE;
 }
 
-// ClearStack: Resets the stack to be empty.
-void SqStack::ClearStack()
+// ClearStack: Destroys all elements and keeps only the bottom segment.
+template <typename T>
+void SqStack<T>::ClearStack()
 {
+    for (Segment *seg = bottom; seg != nullptr;)
+    {
+        int used = (seg == top_seg) ? top_index : STACK_SEGMENT_SIZE;
+        if (seg->prev != nullptr && seg->prev == top_seg)
+        {
+            used = 0; // The spare above the top holds no elements
+        }
+        if (!std::is_trivially_destructible<T>::value)
+        {
+            for (int i = 0; i < used; ++i)
+            {
+                seg->data[i].~T();
+            }
+        }
+        Segment *next = seg->next;
+        if (seg != bottom)
+        {
+            FreeSegment(seg);
+        }
+        seg = next;
+    }
+    bottom->next = nullptr;
+    top_seg = bottom;
     top_index = 0;
+    length = 0;
 }
 
 // IsEmpty: Checks if the stack is empty.
-bool SqStack::IsEmpty()
+template <typename T>
+bool SqStack<T>::IsEmpty()
 {
-    return top_index == 0;
+    return length == 0;
 }
 
 // StackLength: Returns the current number of elements.
-int SqStack::StackLength()
+template <typename T>
+int SqStack<T>::StackLength()
 {
-    return top_index;
+    return length;
 }
 
 // GetTop: Retrieves the top element of the stack into 'e'.
 // Returns false if the stack is empty, true otherwise.
-bool SqStack::GetTop(int &e)
+template <typename T>
+bool SqStack<T>::GetTop(T &e)
 {
     if (IsEmpty())
     {
         return false; // Stack is empty
     }
-    e = data[top_index - 1];
+    e = top_seg->data[top_index - 1];
     return true;
 }
 
 // Push: Inserts element 'e' at the top of the stack.
-// This operation has a time complexity of O(1)
-// Returns false if the stack is full (overflow), true otherwise.
-bool SqStack::Push(int e)
+// This operation has a time complexity of O(1); a full segment is followed
+// by a new one instead of being reallocated.
+// Returns false only if memory allocation fails.
+template <typename T>
+bool SqStack<T>::Push(const T &e)
 {
-    if (top_index >= STACK_MAX_SIZE)
+    if (top_index == STACK_SEGMENT_SIZE && !Advance())
     {
-        return false; // Stack overflow
+        return false; // Memory allocation failed
     }
-    data[top_index] = e;
+    new (top_seg->data + top_index) T(e);
     top_index++;
+    length++;
     return true;
 }
 
 // Pop: Deletes the top element of the stack and returns it in 'e'.
 // This operation has a time complexity of O(1)
 // Returns false if the stack is empty, true otherwise.
-bool SqStack::Pop(int &e)
+template <typename T>
+bool SqStack<T>::Pop(T &e)
 {
     if (IsEmpty())
     {
         return false; // Stack is empty
     }
     top_index--;
-    e = data[top_index];
+    T *slot = top_seg->data + top_index;
+    e = std::move(*slot);
+    slot->~T();
+    length--;
+    if (top_index == 0 && top_seg->prev != nullptr)
+    {
+        StepBack();
+    }
     return true;
 }
 
 // StackTraverse: Prints all elements in the stack from bottom to top.
-void SqStack::StackTraverse()
+template <typename T>
+void SqStack<T>::StackTraverse()
 {
     std::cout << "Stack (bottom -> top): ";
-    for (int i = 0; i < top_index; ++i)
+    for (Segment *seg = bottom; seg != nullptr; seg = seg->next)
     {
-        std::cout << data[i] << " ";
+        int used = (seg == top_seg) ? top_index : STACK_SEGMENT_SIZE;
+        for (int i = 0; i < used; ++i)
+        {
+            std::cout << seg->data[i] << " ";
+        }
+        if (seg == top_seg)
+        {
+            break;
+        }
     }
     std::cout << std::endl;
 }
 
+// PushBulk: Pushes src[0..n) in order, filling each segment with one copy.
+template <typename T>
+bool SqStack<T>::PushBulk(const T *src, int n)
+{
+    if (n < 0 || (n > 0 && src == nullptr))
+    {
+        return false;
+    }
+    while (n > 0)
+    {
+        if (top_index == STACK_SEGMENT_SIZE && !Advance())
+        {
+            return false; // Memory allocation failed; src was pushed up to here
+        }
+        int chunk = STACK_SEGMENT_SIZE - top_index;
+        if (chunk > n)
+        {
+            chunk = n;
+        }
+        T *dst = top_seg->data + top_index;
+        if (kTrivial)
+        {
+            std::memcpy(static_cast<void *>(dst), src, sizeof(T) * chunk);
+        }
+        else
+        {
+            std::uninitialized_copy(src, src + chunk, dst);
+        }
+        top_index += chunk;
+        length += chunk;
+        src += chunk;
+        n -= chunk;
+    }
+    return true;
+}
+
+// PopBulk: Pops the top n elements. dst receives them bottom-to-top, so
+// PushBulk(dst, n) restores the stack. Fails without popping if n > length.
+template <typename T>
+bool SqStack<T>::PopBulk(T *dst, int n)
+{
+    if (n < 0 || n > length || (n > 0 && dst == nullptr))
+    {
+        return false;
+    }
+    int remaining = n;
+    while (remaining > 0)
+    {
+        int chunk = top_index < remaining ? top_index : remaining;
+        T *src = top_seg->data + top_index - chunk;
+        T *out = dst + remaining - chunk; // Fill dst from its end
+        if (kTrivial)
+        {
+            std::memcpy(static_cast<void *>(out), src, sizeof(T) * chunk);
+        }
+        else
+        {
+            for (int k = 0; k < chunk; ++k)
+            {
+                out[k] = std::move(src[k]);
+                src[k].~T();
+            }
+        }
+        top_index -= chunk;
+        length -= chunk;
+        remaining -= chunk;
+        if (top_index == 0 && top_seg->prev != nullptr)
+        {
+            StepBack();
+        }
+    }
+    return true;
+}
+
 // --- Main function acting as a Testbench ---
 
 int main()
 {
     std::cout << "--- Initializing SequentialStack Testbench ---" << std::endl;
-    SqStack myStack;
+    SqStack<int> myStack;
 
     // Test 1: Initial state
     std::cout << "\n[Test 1: Initial State]" << std::endl;
@@ -166,6 +406,41 @@ int main()
     std::cout << "Is stack empty after clearing? " << (myStack.IsEmpty() ? "Yes" : "No") << std::endl;
     myStack.StackTraverse();
 
+    // Test 7: Growth past the old STACK_MAX_SIZE of 100
+    std::cout << "\n[Test 7: Growth]" << std::endl;
+    for (int k = 0; k < 3 * STACK_SEGMENT_SIZE; ++k)
+    {
+        myStack.Push(k);
+    }
+    myStack.GetTop(top_val);
+    std::cout << "Length after " << 3 * STACK_SEGMENT_SIZE << " pushes: " << myStack.StackLength()
+              << ", top element: " << top_val << std::endl;
+
+    // Test 8: Bulk push and pop across segment boundaries
+    std::cout << "\n[Test 8: PushBulk / PopBulk]" << std::endl;
+    const int kBulk = 2 * STACK_SEGMENT_SIZE + 10;
+    int *batch = new int[kBulk];
+    for (int k = 0; k < kBulk; ++k)
+    {
+        batch[k] = -k;
+    }
+    myStack.PushBulk(batch, kBulk);
+    int *out = new int[kBulk];
+    myStack.PopBulk(out, kBulk);
+    bool same = true;
+    for (int k = 0; k < kBulk; ++k)
+    {
+        same = same && out[k] == batch[k];
+    }
+    std::cout << "PopBulk returned the PushBulk span unchanged: " << (same ? "Yes (Correct)" : "No") << std::endl;
+    myStack.GetTop(top_val);
+    std::cout << "Top element afterwards: " << top_val << ", length: " << myStack.StackLength() << std::endl;
+    bool bulk_fail = myStack.PopBulk(out, myStack.StackLength() + 1);
+    std::cout << "Attempt to PopBulk more than the stack holds: " << (bulk_fail ? "Success" : "Failed (Correct)") << std::endl;
+    delete[] batch;
+    delete[] out;
+    myStack.ClearStack();
+
     std::cout << "\n--- Testbench Complete ---" << std::endl;
 
     return 0;
@@ -0,0 +1,112 @@
+#include <iostream>
+#include <string>
+#include <deque>
+#include <random>
+#include "BlockDeque.h"
+
+// main function to test the BlockDeque class
+int main()
+{
+    std::cout << "--- Creating a block deque (" << BLOCK_DEQUE_BLOCK_SIZE << " elements per block) ---" << std::endl;
+    BlockDeque<int> d;
+    std::cout << "Is the deque empty? " << (d.isEmpty() ? "Yes" : "No") << std::endl;
+
+    std::cout << "\n--- Testing push at both ends ---" << std::endl;
+    d.push_back(30);
+    d.push_back(40);
+    d.push_front(20);
+    d.push_front(10);
+    std::cout << "Deque elements (from front to back): ";
+    for (std::size_t i = 0; i < d.size(); ++i)
+    {
+        std::cout << d[i] << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "front() = " << d.front() << ", back() = " << d.back() << std::endl;
+
+    std::cout << "\n--- Testing pop at both ends ---" << std::endl;
+    int item;
+    d.pop_front(item);
+    std::cout << item << " popped from the front." << std::endl;
+    d.pop_back(item);
+    std::cout << item << " popped from the back." << std::endl;
+    d.pop_back(item);
+    d.pop_back(item);
+    std::cout << "Pop on an empty deque: " << (d.pop_front(item) ? "Success" : "Failed (Correct)") << std::endl;
+    try
+    {
+        d.at(0); // This will throw an exception
+    }
+    catch (const std::out_of_range &e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+
+    std::cout << "\n--- Growing past many blocks: no element moves ---" << std::endl;
+    const int kElements = 20 * static_cast<int>(BLOCK_DEQUE_BLOCK_SIZE) + 7;
+    d.push_back(0);
+    int *first = &d.front();
+    for (int k = 1; k <= kElements; ++k)
+    {
+        if (k % 2 == 0)
+            d.push_back(k);
+        else
+            d.push_front(-k);
+    }
+    std::cout << "Size after growth: " << d.size() << std::endl;
+    std::cout << "Address of the first element unchanged: " << (&d[kElements / 2 + 1] == first ? "Yes (Correct)" : "No") << std::endl;
+
+    std::cout << "\n--- Random operations against std::deque ---" << std::endl;
+    std::mt19937 rng(2025);
+    std::deque<int> reference(d.size());
+    for (std::size_t i = 0; i < d.size(); ++i)
+        reference[i] = d[i];
+    bool same = true;
+    for (int step = 0; step < 200000 && same; ++step)
+    {
+        int v = static_cast<int>(rng() % 1000);
+        switch (rng() % 5)
+        {
+        case 0:
+            d.push_back(v);
+            reference.push_back(v);
+            break;
+        case 1:
+            d.push_front(v);
+            reference.push_front(v);
+            break;
+        case 2:
+            if (d.pop_back(item))
+            {
+                same = same && item == reference.back();
+                reference.pop_back();
+            }
+            break;
+        case 3:
+            if (d.pop_front(item))
+            {
+                same = same && item == reference.front();
+                reference.pop_front();
+            }
+            break;
+        default:
+            if (!reference.empty())
+            {
+                std::size_t i = rng() % reference.size();
+                same = same && d[i] == reference[i];
+            }
+        }
+        same = same && d.size() == reference.size();
+    }
+    std::cout << "Matches std::deque after 200000 operations: " << (same ? "Yes (Correct)" : "No") << std::endl;
+
+    std::cout << "\n--- Testing heavy payloads (std::string) ---" << std::endl;
+    BlockDeque<std::string> words;
+    words.emplace_back(40, 'a');
+    words.push_front(std::string("front"));
+    std::string out;
+    words.pop_back(out);
+    std::cout << "Popped string of length " << out.size() << "; \"" << words.front() << "\" left for the destructor" << std::endl;
+
+    return 0;
+}
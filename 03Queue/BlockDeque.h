@@ -0,0 +1,207 @@
+#ifndef BLOCKDEQUE_H
+#define BLOCKDEQUE_H
+
+#include <cstddef>   // For std::size_t
+#include <new>       // For ::operator new, placement new
+#include <stdexcept> // For throwing exceptions
+#include <utility>   // For std::move, std::forward
+
+const std::size_t BLOCK_DEQUE_BLOCK_SIZE = 512; // Elements per block; a power of two
+
+/**
+ * @class BlockDeque
+ * @brief A double-ended queue stored as a circular map of fixed-size blocks.
+ *
+ * This is CircularArrayQueue applied twice: the elements form a ring over
+ * map_size * BLOCK_DEQUE_BLOCK_SIZE positions, and position g lives in block
+ * map[g / BLOCK] at offset g % BLOCK. Both sizes are powers of two, so the
+ * "% capacity" of the circular queue becomes a mask.
+ *
+ * When the ring gets full, only the map (an array of block pointers) is
+ * doubled; the blocks themselves stay where they are, so elements are never
+ * moved and references to them stay valid. One block is always kept free, so
+ * the front and the back never share a block across the wrap-around and the
+ * blocks can be copied into the new map in order. Emptied blocks are kept for
+ * reuse until the deque is destroyed.
+ *
+ * push/pop at both ends are O(1) (amortized over map growth) and operator[]
+ * is O(1), so one BlockDeque serves as queue, stack and 0-1 BFS deque.
+ */
+template <typename T>
+class BlockDeque
+{
+private:
+    static const std::size_t kBlock = BLOCK_DEQUE_BLOCK_SIZE;
+    static_assert((BLOCK_DEQUE_BLOCK_SIZE & (BLOCK_DEQUE_BLOCK_SIZE - 1)) == 0,
+                  "BLOCK_DEQUE_BLOCK_SIZE must be a power of two");
+
+    T **map;              // Circular array of blocks; nullptr until first used
+    std::size_t map_size; // Number of block slots; a power of two
+    std::size_t mask;     // map_size * kBlock - 1, for ring positions
+    std::size_t limit;    // (map_size - 1) * kBlock: size that triggers growth
+    std::size_t begin;    // Ring position of the front element
+    std::size_t count;    // Current number of elements
+
+    // Slot: Address of ring position g, allocating its block if needed.
+    T *Slot(std::size_t g)
+    {
+        T *&block = map[g / kBlock];
+        if (block == nullptr)
+        {
+            block = static_cast<T *>(::operator new(sizeof(T) * kBlock));
+        }
+        return block + (g % kBlock);
+    }
+
+    T &At(std::size_t i) const
+    {
+        std::size_t g = (begin + i) & mask;
+        return map[g / kBlock][g % kBlock];
+    }
+
+    // Grow: Doubles the map once only the spare block is left. Block pointers
+    // are copied starting with the front's block; no element moves.
+    void GrowIfFull()
+    {
+        if (count < limit)
+        {
+            return;
+        }
+        std::size_t first = begin / kBlock;
+        T **bigger = new T *[map_size * 2]();
+        for (std::size_t k = 0; k < map_size; ++k)
+        {
+            bigger[k] = map[(first + k) & (map_size - 1)];
+        }
+        delete[] map;
+        map = bigger;
+        map_size *= 2;
+        mask = map_size * kBlock - 1;
+        limit = (map_size - 1) * kBlock;
+        begin %= kBlock;
+    }
+
+public:
+    // Constructor: creates an empty deque; no block is allocated yet.
+    BlockDeque() : map(new T *[2]()), map_size(2), mask(2 * kBlock - 1), limit(kBlock), begin(0), count(0) {}
+
+    // Destructor: destroys the elements in place and frees every block.
+    ~BlockDeque()
+    {
+        clear();
+        for (std::size_t k = 0; k < map_size; ++k)
+        {
+            ::operator delete(map[k]);
+        }
+        delete[] map;
+    }
+
+    BlockDeque(const BlockDeque &) = delete;
+    BlockDeque &operator=(const BlockDeque &) = delete;
+
+    bool isEmpty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    // Random access: no bounds check, like std::deque::operator[]
+    T &operator[](std::size_t i) { return At(i); }
+    const T &operator[](std::size_t i) const { return At(i); }
+
+    // Bounds-checked access
+    T &at(std::size_t i)
+    {
+        if (i >= count)
+        {
+            throw std::out_of_range("Error: BlockDeque index out of range.");
+        }
+        return At(i);
+    }
+
+    T &front()
+    {
+        if (isEmpty())
+        {
+            throw std::runtime_error("Error: Deque is empty.");
+        }
+        return At(0);
+    }
+
+    T &back()
+    {
+        if (isEmpty())
+        {
+            throw std::runtime_error("Error: Deque is empty.");
+        }
+        return At(count - 1);
+    }
+
+    // Constructs an element after the back from 'args'.
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
+    {
+        GrowIfFull();
+        T *slot = Slot((begin + count) & mask);
+        new (slot) T(std::forward<Args>(args)...);
+        count++;
+        return *slot;
+    }
+
+    // Constructs an element before the front from 'args'.
+    template <typename... Args>
+    T &emplace_front(Args &&...args)
+    {
+        GrowIfFull();
+        std::size_t g = (begin - 1) & mask;
+        T *slot = Slot(g);
+        new (slot) T(std::forward<Args>(args)...);
+        begin = g;
+        count++;
+        return *slot;
+    }
+
+    void push_back(const T &item) { emplace_back(item); }
+    void push_back(T &&item) { emplace_back(std::move(item)); }
+    void push_front(const T &item) { emplace_front(item); }
+    void push_front(T &&item) { emplace_front(std::move(item)); }
+
+    // Moves the front element into 'out'; returns false if the deque is empty.
+    bool pop_front(T &out)
+    {
+        if (isEmpty())
+        {
+            return false;
+        }
+        T &item = At(0);
+        out = std::move(item);
+        item.~T();
+        begin = (begin + 1) & mask;
+        count--;
+        return true;
+    }
+
+    // Moves the back element into 'out'; returns false if the deque is empty.
+    bool pop_back(T &out)
+    {
+        if (isEmpty())
+        {
+            return false;
+        }
+        T &item = At(count - 1);
+        out = std::move(item);
+        item.~T();
+        count--;
+        return true;
+    }
+
+    // Destroys every element; the blocks are kept for reuse.
+    void clear()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            At(i).~T();
+        }
+        begin = 0;
+        count = 0;
+    }
+};
+
+#endif // BLOCKDEQUE_H
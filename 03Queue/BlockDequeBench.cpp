@@ -0,0 +1,238 @@
+#include <iostream>
+#include <iomanip> // For std::setw
+#include <deque>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <climits> // For INT_MAX
+#include "BlockDeque.h"
+#include "CircularArrayQueue.h"
+#include "LinkedQueue.h"
+
+/**
+ * Benchmark: BlockDeque vs std::deque vs the existing queues on grid graphs.
+ *   - BFS: unweighted shortest paths from a corner, using the container as a
+ *     FIFO queue (CircularArrayQueue is sized for every cell up front).
+ *   - 0-1 BFS: entering a cell costs 0 or 1; cost-0 moves are pushed at the
+ *     front and cost-1 moves at the back, so only the deques take part.
+ *   - fill/drain: n pushes at the back, then n pops at the front.
+ * Each time is the best of three runs. The sum of all distances is compared
+ * across containers.
+ */
+
+typedef std::chrono::steady_clock Clock;
+
+double ElapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Common interface: PushBack, PushFront (deques only), PopFront, Empty.
+struct BlockAdapter
+{
+    BlockDeque<int> d;
+    explicit BlockAdapter(int) {}
+    void PushBack(int v) { d.push_back(v); }
+    void PushFront(int v) { d.push_front(v); }
+    bool PopFront(int &v) { return d.pop_front(v); }
+};
+
+struct StdDequeAdapter
+{
+    std::deque<int> d;
+    explicit StdDequeAdapter(int) {}
+    void PushBack(int v) { d.push_back(v); }
+    void PushFront(int v) { d.push_front(v); }
+    bool PopFront(int &v)
+    {
+        if (d.empty())
+            return false;
+        v = d.front();
+        d.pop_front();
+        return true;
+    }
+};
+
+struct CircularAdapter
+{
+    CircularArrayQueue<int> q;
+    explicit CircularAdapter(int capacity) : q(capacity) {}
+    void PushBack(int v) { q.enqueue(v); }
+    bool PopFront(int &v) { return q.try_dequeue(v); }
+};
+
+struct LinkedAdapter
+{
+    LinkedQueue<int> q;
+    explicit LinkedAdapter(int) {}
+    void PushBack(int v) { q.enqueue(v); }
+    bool PopFront(int &v) { return q.try_dequeue(v); }
+};
+
+struct Grid
+{
+    int w, h;
+    std::vector<char> wall; // Blocked cells
+    std::vector<char> cost; // 0/1 cost of entering a cell
+};
+
+// Bfs: Sum of BFS distances from cell 0 to every reachable cell.
+template <typename Queue>
+long long Bfs(const Grid &g)
+{
+    int n = g.w * g.h;
+    std::vector<int> dist(n, -1);
+    Queue q(n);
+    dist[0] = 0;
+    q.PushBack(0);
+    long long sum = 0;
+    int cell;
+    while (q.PopFront(cell))
+    {
+        sum += dist[cell];
+        int x = cell % g.w, y = cell / g.w;
+        const int nx[4] = {x + 1, x - 1, x, x};
+        const int ny[4] = {y, y, y + 1, y - 1};
+        for (int k = 0; k < 4; ++k)
+        {
+            if (nx[k] < 0 || nx[k] >= g.w || ny[k] < 0 || ny[k] >= g.h)
+                continue;
+            int next = ny[k] * g.w + nx[k];
+            if (g.wall[next] || dist[next] != -1)
+                continue;
+            dist[next] = dist[cell] + 1;
+            q.PushBack(next);
+        }
+    }
+    return sum;
+}
+
+// ZeroOneBfs: Sum of 0-1 shortest path costs from cell 0 (walls ignored).
+template <typename Deque>
+long long ZeroOneBfs(const Grid &g)
+{
+    int n = g.w * g.h;
+    std::vector<int> dist(n, INT_MAX);
+    Deque d(n);
+    dist[0] = 0;
+    d.PushBack(0);
+    int cell;
+    while (d.PopFront(cell))
+    {
+        int x = cell % g.w, y = cell / g.w;
+        const int nx[4] = {x + 1, x - 1, x, x};
+        const int ny[4] = {y, y, y + 1, y - 1};
+        for (int k = 0; k < 4; ++k)
+        {
+            if (nx[k] < 0 || nx[k] >= g.w || ny[k] < 0 || ny[k] >= g.h)
+                continue;
+            int next = ny[k] * g.w + nx[k];
+            int w = g.cost[next];
+            if (dist[cell] + w >= dist[next])
+                continue;
+            dist[next] = dist[cell] + w;
+            if (w == 0)
+                d.PushFront(next);
+            else
+                d.PushBack(next);
+        }
+    }
+    long long sum = 0;
+    for (int v : dist)
+        sum += v;
+    return sum;
+}
+
+// FillDrain: n pushes followed by n pops; returns the sum of popped values.
+template <typename Queue>
+long long FillDrain(int n)
+{
+    Queue q(n);
+    for (int k = 0; k < n; ++k)
+        q.PushBack(k);
+    long long sum = 0;
+    int v;
+    while (q.PopFront(v))
+        sum += v;
+    return sum;
+}
+
+// Time: Best of three runs, so the container measured first does not pay
+// alone for faulting in fresh heap pages.
+template <typename Fn>
+double Time(Fn fn, long long &result)
+{
+    double best = 0;
+    for (int run = 0; run < 3; ++run)
+    {
+        Clock::time_point start = Clock::now();
+        result = fn();
+        double ms = ElapsedMs(start);
+        if (run == 0 || ms < best)
+            best = ms;
+    }
+    return best;
+}
+
+void Row(const char *name, double bfs, double zero_one, double fill)
+{
+    std::cout << std::setw(20) << name << std::fixed << std::setprecision(2) << std::setw(12) << bfs;
+    if (zero_one >= 0)
+        std::cout << std::setw(12) << zero_one;
+    else
+        std::cout << std::setw(12) << "-";
+    std::cout << std::setw(12) << fill << std::endl;
+}
+
+int main()
+{
+    std::cout << "--- BlockDeque Benchmark (ms) ---" << std::endl;
+    std::mt19937 rng(2025);
+
+    for (int side = 256; side <= 2048; side *= 2)
+    {
+        Grid g;
+        g.w = g.h = side;
+        int n = side * side;
+        g.wall.resize(n);
+        g.cost.resize(n);
+        for (int k = 0; k < n; ++k)
+        {
+            g.wall[k] = (rng() % 100) < 20;
+            g.cost[k] = rng() % 2;
+        }
+        g.wall[0] = g.wall[1] = g.wall[side] = 0; // Keep the start from being walled in
+
+        std::cout << "\n" << side << " x " << side << " grid (" << n << " cells)" << std::endl;
+        std::cout << std::setw(20) << "container" << std::setw(12) << "BFS" << std::setw(12) << "0-1 BFS"
+                  << std::setw(12) << "fill/drain" << std::endl;
+
+        long long base_bfs, base_01, base_fill, r1, r2, r3;
+        double b = Time([&]() { return Bfs<BlockAdapter>(g); }, base_bfs);
+        double z = Time([&]() { return ZeroOneBfs<BlockAdapter>(g); }, base_01);
+        double f = Time([&]() { return FillDrain<BlockAdapter>(n); }, base_fill);
+        Row("BlockDeque", b, z, f);
+
+        b = Time([&]() { return Bfs<StdDequeAdapter>(g); }, r1);
+        z = Time([&]() { return ZeroOneBfs<StdDequeAdapter>(g); }, r2);
+        f = Time([&]() { return FillDrain<StdDequeAdapter>(n); }, r3);
+        Row("std::deque", b, z, f);
+        if (r1 != base_bfs || r2 != base_01 || r3 != base_fill)
+            std::cout << "Mismatch: std::deque disagrees with BlockDeque!" << std::endl;
+
+        b = Time([&]() { return Bfs<CircularAdapter>(g); }, r1);
+        f = Time([&]() { return FillDrain<CircularAdapter>(n); }, r3);
+        Row("CircularArrayQueue", b, -1, f);
+        if (r1 != base_bfs || r3 != base_fill)
+            std::cout << "Mismatch: CircularArrayQueue disagrees with BlockDeque!" << std::endl;
+
+        b = Time([&]() { return Bfs<LinkedAdapter>(g); }, r1);
+        f = Time([&]() { return FillDrain<LinkedAdapter>(n); }, r3);
+        Row("LinkedQueue", b, -1, f);
+        if (r1 != base_bfs || r3 != base_fill)
+            std::cout << "Mismatch: LinkedQueue disagrees with BlockDeque!" << std::endl;
+    }
+
+    std::cout << "\n--- Benchmark Complete ---" << std::endl;
+    return 0;
+}
@@ -1,112 +1,8 @@
 #include <iostream>
-#include <stdexcept> // For throwing exceptions
-
-// A generic circular queue template class
-template <typename T>
-class CircularArrayQueue
-{
-private:
-    T *arr;       // Pointer to the array storing queue elements
-    int capacity; // Maximum capacity of the queue
-    int front;    // Index of the front element
-    int rear;     // Index for the next element at the rear
-    int count;    // Current number of elements in the queue
-
-public:
-    // Constructor: initializes a queue of a given size
-    CircularArrayQueue(int size)
-    {
-        capacity = size;
-        arr = new T[capacity];
-        front = 0;
-        rear = 0;
-        count = 0; // Initial element count is 0
-        std::cout << "Circular queue created with capacity " << capacity << "." << std::endl;
-    }
-
-    // Destructor: frees the allocated memory
-    ~CircularArrayQueue()
-    {
-        delete[] arr;
-        std::cout << "Circular queue destroyed." << std::endl;
-    }
-
-    // Checks if the queue is empty
-    bool isEmpty() const
-    {
-        return count == 0;
-    }
-
-    // Checks if the queue is full
-    bool isFull() const
-    {
-        return count == capacity;
-    }
-
-    // Gets the current size of the queue
-    int size() const
-    {
-        return count;
-    }
-
-    // Adds an element to the rear of the queue (enqueue)
-    void enqueue(const T &item)
-    {
-        if (isFull())
-        {
-            std::cerr << "Error: Queue is full. Cannot enqueue " << item << "." << std::endl;
-            return;
-        }
-        arr[rear] = item;
-        // Use modulo operator for circular behavior
-        rear = (rear + 1) % capacity;
-        count++;
-        std::cout << item << " has been enqueued." << std::endl;
-    }
-
-    // Removes an element from the front of the queue (dequeue)
-    T dequeue()
-    {
-        if (isEmpty())
-        {
-            throw std::runtime_error("Error: Queue is empty. Cannot dequeue.");
-        }
-        T item = arr[front];
-        // Use modulo operator for circular behavior
-        front = (front + 1) % capacity;
-        count--;
-        std::cout << item << " has been dequeued." << std::endl;
-        return item;
-    }
-
-    // Gets the front element without removing it
-    T getFront() const
-    {
-        if (isEmpty())
-        {
-            throw std::runtime_error("Error: Queue is empty.");
-        }
-        return arr[front];
-    }
-
-    // Displays all elements in the queue
-    void display() const
-    {
-        if (isEmpty())
-        {
-            std::cout << "Queue is empty." << std::endl;
-            return;
-        }
-        std::cout << "Queue elements (from front to rear): ";
-        for (int i = 0; i < count; i++)
-        {
-            // Starting from front, circularly access count elements
-            int index = (front + i) % capacity;
-            std::cout << arr[index] << " ";
-        }
-        std::cout << std::endl;
-    }
-};
+#include <stdexcept> // For std::runtime_error
+#include <string>
+#include <vector>
+#include "CircularArrayQueue.h"
 
 // main function to test the CircularArrayQueue class
 int main()
@@ -127,12 +23,14 @@ int main()
     q.display();
 
     std::cout << "Is the queue full? " << (q.isFull() ? "Yes" : "No") << std::endl;
-    q.enqueue(60); // This should fail because the queue is full
+    // This should fail because the queue is full; it is counted, not printed
+    std::cout << "Enqueue 60: " << (q.enqueue(60) ? "Success" : "Failed (Correct)") << std::endl;
+    std::cout << "Overflows so far: " << q.overflowCount() << std::endl;
 
     std::cout << "\n--- Testing dequeue operation ---" << std::endl;
-    q.dequeue();
+    std::cout << q.dequeue() << " has been dequeued." << std::endl;
     q.display();
-    q.dequeue();
+    std::cout << q.dequeue() << " has been dequeued." << std::endl;
     q.display();
 
     std::cout << "\n--- Solving the 'fake overflow' issue: Enqueue again ---" << std::endl;
@@ -144,22 +42,18 @@ int main()
 
     std::cout << "Is the queue full? " << (q.isFull() ? "Yes" : "No") << std::endl;
     q.enqueue(80); // This should fail
+    std::cout << "Overflows so far: " << q.overflowCount() << std::endl;
 
-    std::cout << "\n--- Dequeueing all elements ---" << std::endl;
-    try
+    std::cout << "\n--- Dequeueing all elements with try_dequeue ---" << std::endl;
+    int item;
+    while (q.try_dequeue(item))
     {
-        while (!q.isEmpty())
-        {
-            q.dequeue();
-        }
-    }
-    catch (const std::runtime_error &e)
-    {
-        std::cerr << e.what() << std::endl;
+        std::cout << item << " has been dequeued." << std::endl;
     }
     q.display();
 
     std::cout << "\n--- Testing dequeue on an empty queue ---" << std::endl;
+    std::cout << "try_dequeue: " << (q.try_dequeue(item) ? "Success" : "Failed (Correct)") << std::endl;
     try
     {
         q.dequeue(); // This will throw an exception
@@ -169,5 +63,20 @@ int main()
         std::cerr << e.what() << std::endl;
     }
 
+    std::cout << "\n--- Testing heavy payloads (std::vector) ---" << std::endl;
+    CircularArrayQueue<std::vector<int>> batches(2);
+    std::vector<int> big(1000, 7);
+    const int *buffer = big.data();
+    batches.enqueue(std::move(big)); // The buffer moves into the queue
+    batches.emplace(3, 1);           // Built in place as std::vector<int>(3, 1)
+    std::cout << "Third enqueue accepted: " << (batches.emplace(1, 0) ? "Yes" : "No (Correct)") << std::endl;
+    std::vector<int> out;
+    batches.try_dequeue(out);
+    std::cout << "Dequeued vector of size " << out.size() << ", same buffer (no copy): "
+              << (out.data() == buffer ? "Yes (Correct)" : "No") << std::endl;
+    std::cout << "Overflows: " << batches.overflowCount() << std::endl;
+    batches.resetOverflowCount();
+    std::cout << "Overflows after reset: " << batches.overflowCount() << std::endl;
+
     return 0;
-}
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+#ifndef CIRCULARARRAYQUEUE_H
+#define CIRCULARARRAYQUEUE_H
+
+#include <iostream>
+#include <stdexcept> // For throwing exceptions
+#include <new>       // For ::operator new, placement new
+#include <utility>   // For std::move, std::forward
+
+// A generic circular queue template class
+// Slots hold raw storage: an element is constructed when it is enqueued and
+// destroyed when it is dequeued, so T needs no default constructor and a
+// moved-in payload is never copied.
+template <typename T>
+class CircularArrayQueue
+{
+private:
+    T *arr;                // Pointer to the array storing queue elements
+    int capacity;          // Maximum capacity of the queue
+    int front;             // Index of the front element
+    int rear;              // Index for the next element at the rear
+    int count;             // Current number of elements in the queue
+    std::size_t overflows; // Enqueues rejected because the queue was full
+
+public:
+    // Constructor: initializes a queue of a given size
+    CircularArrayQueue(int size)
+    {
+        capacity = size;
+        arr = static_cast<T *>(::operator new(sizeof(T) * capacity));
+        front = 0;
+        rear = 0;
+        count = 0; // Initial element count is 0
+        overflows = 0;
+    }
+
+    // Destructor: destroys the remaining elements and frees the allocated memory
+    ~CircularArrayQueue()
+    {
+        for (int i = 0; i < count; i++)
+        {
+            arr[(front + i) % capacity].~T();
+        }
+        ::operator delete(arr);
+    }
+
+    CircularArrayQueue(const CircularArrayQueue &) = delete;
+    CircularArrayQueue &operator=(const CircularArrayQueue &) = delete;
+
+    // Checks if the queue is empty
+    bool isEmpty() const
+    {
+        return count == 0;
+    }
+
+    // Checks if the queue is full
+    bool isFull() const
+    {
+        return count == capacity;
+    }
+
+    // Gets the current size of the queue
+    int size() const
+    {
+        return count;
+    }
+
+    // Number of enqueues rejected because the queue was full (polled instead
+    // of printed, so a full queue costs no I/O on the hot path)
+    std::size_t overflowCount() const
+    {
+        return overflows;
+    }
+
+    void resetOverflowCount()
+    {
+        overflows = 0;
+    }
+
+    // Constructs an element at the rear of the queue from 'args'
+    // Returns false (and counts an overflow) if the queue is full
+    template <typename... Args>
+    bool emplace(Args &&...args)
+    {
+        if (isFull())
+        {
+            overflows++;
+            return false;
+        }
+        new (arr + rear) T(std::forward<Args>(args)...);
+        // Use modulo operator for circular behavior
+        rear = (rear + 1) % capacity;
+        count++;
+        return true;
+    }
+
+    // Adds an element to the rear of the queue (enqueue)
+    bool enqueue(const T &item)
+    {
+        return emplace(item);
+    }
+
+    bool enqueue(T &&item)
+    {
+        return emplace(std::move(item));
+    }
+
+    // Moves the front element into 'out'; returns false if the queue is empty
+    bool try_dequeue(T &out)
+    {
+        if (isEmpty())
+        {
+            return false;
+        }
+        out = std::move(arr[front]);
+        arr[front].~T();
+        // Use modulo operator for circular behavior
+        front = (front + 1) % capacity;
+        count--;
+        return true;
+    }
+
+    // Removes an element from the front of the queue (dequeue)
+    T dequeue()
+    {
+        if (isEmpty())
+        {
+            throw std::runtime_error("Error: Queue is empty. Cannot dequeue.");
+        }
+        T item = std::move(arr[front]);
+        arr[front].~T();
+        front = (front + 1) % capacity;
+        count--;
+        return item;
+    }
+
+    // Gets the front element without removing it
+    T getFront() const
+    {
+        if (isEmpty())
+        {
+            throw std::runtime_error("Error: Queue is empty.");
+        }
+        return arr[front];
+    }
+
+    // Displays all elements in the queue
+    void display() const
+    {
+        if (isEmpty())
+        {
+            std::cout << "Queue is empty." << std::endl;
+            return;
+        }
+        std::cout << "Queue elements (from front to rear): ";
+        for (int i = 0; i < count; i++)
+        {
+            // Starting from front, circularly access count elements
+            int index = (front + i) % capacity;
+            std::cout << arr[index] << " ";
+        }
+        std::cout << std::endl;
+    }
+};
+
+#endif // CIRCULARARRAYQUEUE_H
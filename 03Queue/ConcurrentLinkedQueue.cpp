@@ -0,0 +1,95 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <chrono>
+#include "ConcurrentLinkedQueue.h"
+
+// main function to test the ConcurrentLinkedQueue class
+int main()
+{
+    std::cout << "--- Creating a concurrent linked queue ---" << std::endl;
+    ConcurrentLinkedQueue<int> q;
+    std::cout << "Is the queue empty? " << (q.isEmpty() ? "Yes" : "No") << std::endl;
+
+    std::cout << "\n--- Testing enqueue and try_dequeue ---" << std::endl;
+    q.enqueue(10);
+    q.enqueue(20);
+    q.emplace(30);
+    std::cout << "Current queue size: " << q.size() << std::endl;
+    int item;
+    std::cout << "Dequeued in order: ";
+    while (q.try_dequeue(item))
+    {
+        std::cout << item << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "Dequeue on an empty queue: " << (q.try_dequeue(item) ? "Success" : "Failed (Correct)") << std::endl;
+
+    std::cout << "\n--- Testing move-aware enqueue ---" << std::endl;
+    ConcurrentLinkedQueue<std::string> words;
+    std::string long_word(40, 'a');
+    words.enqueue(std::move(long_word));
+    words.emplace(5, 'z');
+    std::cout << "Source string after a moving enqueue is empty: " << (long_word.empty() ? "Yes" : "No") << std::endl;
+    std::string first;
+    words.try_dequeue(first);
+    std::cout << "Dequeued string of length " << first.size() << "; one string left for the destructor" << std::endl;
+
+    std::cout << "\n--- 4 producers and 4 consumers ---" << std::endl;
+    const int kProducers = 4, kConsumers = 4, kPerProducer = 200000;
+    const int kTotal = kProducers * kPerProducer;
+    ConcurrentLinkedQueue<int> shared;
+    std::vector<std::atomic<int>> seen(kTotal);
+    for (std::atomic<int> &s : seen)
+        s.store(0);
+    std::vector<std::vector<int>> last_from(kConsumers, std::vector<int>(kProducers, -1));
+    bool fifo = true;
+    std::atomic<int> consumed(0);
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (int p = 0; p < kProducers; ++p)
+    {
+        threads.emplace_back([&, p]() {
+            for (int k = 0; k < kPerProducer; ++k)
+                shared.enqueue(p * kPerProducer + k);
+        });
+    }
+    std::vector<char> in_order(kConsumers, 1);
+    for (int c = 0; c < kConsumers; ++c)
+    {
+        threads.emplace_back([&, c]() {
+            int v;
+            while (consumed.load() < kTotal)
+            {
+                if (!shared.try_dequeue(v))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                consumed.fetch_add(1);
+                seen[v].fetch_add(1);
+                // Items from one producer must arrive in the order it sent them
+                int producer = v / kPerProducer;
+                if (v <= last_from[c][producer])
+                    in_order[c] = 0;
+                last_from[c][producer] = v;
+            }
+        });
+    }
+    for (std::thread &t : threads)
+        t.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    bool exactly_once = true;
+    for (std::atomic<int> &s : seen)
+        exactly_once = exactly_once && s.load() == 1;
+    for (char ok : in_order)
+        fifo = fifo && ok;
+    std::cout << "Every item dequeued exactly once: " << (exactly_once ? "Yes (Correct)" : "No") << std::endl;
+    std::cout << "Per-producer FIFO order kept: " << (fifo ? "Yes (Correct)" : "No") << std::endl;
+    std::cout << "Queue is empty afterwards: " << (shared.isEmpty() ? "Yes (Correct)" : "No") << std::endl;
+    std::cout << "Throughput: " << kTotal / seconds / 1e6 << " million items/sec" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+#ifndef CONCURRENTLINKEDQUEUE_H
+#define CONCURRENTLINKEDQUEUE_H
+
+#include <atomic>
+#include <new>     // For placement new
+#include <utility> // For std::move, std::forward
+#include "../02Stack/HazardPointer.h"
+
+/**
+ * @class ConcurrentLinkedQueue
+ * @brief An unbounded lock-free linked queue (Michael-Scott queue) that many
+ * producer and consumer threads can share.
+ *
+ * As in LinkedQueue, elements are dequeued at front (head) and enqueued at
+ * rear (tail), but the list always starts with a dummy node, so enqueue only
+ * touches tail and dequeue only touches head:
+ *   - enqueue links the new node after the last node with a CAS on its next
+ *     pointer, then swings tail forward (any thread that sees tail lagging
+ *     behind helps to swing it).
+ *   - dequeue swings head to the first real node with a CAS; that node becomes
+ *     the new dummy and the old dummy is retired through hazard pointers.
+ * Only the thread whose CAS succeeded touches the element, so it is moved out
+ * rather than copied.
+ */
+template <typename T>
+class ConcurrentLinkedQueue
+{
+private:
+    struct Node
+    {
+        std::atomic<Node *> next;
+        alignas(T) unsigned char storage[sizeof(T)]; // Empty in the dummy node
+
+        Node() : next(nullptr) {}
+        T *Data() { return reinterpret_cast<T *>(storage); }
+    };
+
+    alignas(64) std::atomic<Node *> head; // Dummy node; head->next is the front
+    alignas(64) std::atomic<Node *> tail; // Last node, or the one just before it
+    alignas(64) std::atomic<int> count;   // Element count; a snapshot under concurrency
+
+    static void *Decode(Node *p) { return p; }
+
+    // Link: Appends a node that already holds its element.
+    void Link(Node *node)
+    {
+        HazardThread &hp = ThisHazardThread();
+        while (true)
+        {
+            Node *last = hp.Protect(0, tail, Decode);
+            Node *next = last->next.load(std::memory_order_acquire);
+            if (last != tail.load(std::memory_order_acquire))
+                continue; // tail moved while we read it
+            if (next != nullptr)
+            {
+                tail.compare_exchange_weak(last, next); // Help a lagging tail along
+                continue;
+            }
+            if (last->next.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed))
+            {
+                tail.compare_exchange_strong(last, node); // Failing is fine: someone helped
+                break;
+            }
+        }
+        hp.Clear(0);
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+public:
+    ConcurrentLinkedQueue()
+    {
+        Node *dummy = new Node();
+        head.store(dummy);
+        tail.store(dummy);
+        count.store(0);
+    }
+
+    // Destructor: no other thread may use the queue any more, so the nodes are
+    // freed directly. Every node after the dummy still holds an element.
+    ~ConcurrentLinkedQueue()
+    {
+        Node *current = head.load();
+        Node *next = current->next.load();
+        delete current;
+        while (next != nullptr)
+        {
+            current = next;
+            next = current->next.load();
+            current->Data()->~T();
+            delete current;
+        }
+    }
+
+    ConcurrentLinkedQueue(const ConcurrentLinkedQueue &) = delete;
+    ConcurrentLinkedQueue &operator=(const ConcurrentLinkedQueue &) = delete;
+
+    bool isEmpty() const
+    {
+        return head.load()->next.load() == nullptr;
+    }
+
+    int size() const
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    // Constructs an element at the rear of the queue from 'args'.
+    template <typename... Args>
+    void emplace(Args &&...args)
+    {
+        Node *node = new Node();
+        new (node->Data()) T(std::forward<Args>(args)...);
+        Link(node);
+    }
+
+    void enqueue(const T &item) { emplace(item); }
+    void enqueue(T &&item) { emplace(std::move(item)); }
+
+    // Moves the front element into 'item'; returns false if the queue is empty.
+    bool try_dequeue(T &item)
+    {
+        HazardThread &hp = ThisHazardThread();
+        Node *first;
+        Node *next;
+        while (true)
+        {
+            first = hp.Protect(0, head, Decode);
+            // Protect next as well; it is only safe to use if first is still
+            // the head afterwards, since then next cannot have been retired.
+            next = hp.Protect(1, first->next, Decode);
+            if (first != head.load(std::memory_order_acquire))
+                continue;
+            if (next == nullptr)
+            {
+                hp.Clear(0);
+                hp.Clear(1);
+                return false; // Queue is empty
+            }
+            Node *last = tail.load(std::memory_order_acquire);
+            if (first == last)
+            {
+                tail.compare_exchange_weak(last, next); // tail lags behind; help it
+                continue;
+            }
+            if (head.compare_exchange_weak(first, next, std::memory_order_acquire, std::memory_order_relaxed))
+                break;
+        }
+        // next is the new dummy; this thread alone owns its element
+        item = std::move(*next->Data());
+        next->Data()->~T();
+        hp.Clear(0);
+        hp.Clear(1);
+        count.fetch_sub(1, std::memory_order_relaxed);
+        hp.Retire(first);
+        return true;
+    }
+};
+
+#endif // CONCURRENTLINKEDQUEUE_H
@@ -1,124 +1,7 @@
 #include <iostream>
-#include <stdexcept> // For throwing exceptions
-
-// A generic Node for the linked list
-template <typename T>
-struct Node
-{
-    T data;
-    Node *next;
-
-    // Node constructor
-    Node(const T &val) : data(val), next(nullptr) {}
-};
-
-// A generic linked list based queue template class
-template <typename T>
-class LinkedQueue
-{
-private:
-    Node<T> *front; // Pointer to the front of the queue
-    Node<T> *rear;  // Pointer to the rear of the queue
-    int count;      // Current number of elements in the queue
-
-public:
-    // Constructor: initializes an empty queue
-    LinkedQueue() : front(nullptr), rear(nullptr), count(0)
-    {
-        std::cout << "Linked queue created." << std::endl;
-    }
-
-    // Destructor: frees all allocated memory
-    ~LinkedQueue()
-    {
-        while (!isEmpty())
-        {
-            dequeue(); // Dequeue all elements to free memory
-        }
-        std::cout << "Linked queue destroyed." << std::endl;
-    }
-
-    // Checks if the queue is empty
-    bool isEmpty() const
-    {
-        return front == nullptr;
-    }
-
-    // Gets the current size of the queue
-    int size() const
-    {
-        return count;
-    }
-
-    // Adds an element to the rear of the queue (enqueue)
-    void enqueue(const T &item)
-    {
-        Node<T> *newNode = new Node<T>(item);
-        if (isEmpty())
-        {
-            front = rear = newNode; // The new node is both front and rear
-        }
-        else
-        {
-            rear->next = newNode; // Link the old rear to the new node
-            rear = newNode;       // Update the rear pointer
-        }
-        count++;
-        std::cout << item << " has been enqueued." << std::endl;
-    }
-
-    // Removes an element from the front of the queue (dequeue)
-    T dequeue()
-    {
-        if (isEmpty())
-        {
-            throw std::runtime_error("Error: Queue is empty. Cannot dequeue.");
-        }
-
-        Node<T> *temp = front; // Temporarily store the front node
-        T item = front->data;  // Get the data from the front node
-        front = front->next;   // Move front to the next node
-
-        // If the queue becomes empty after dequeue, update rear as well
-        if (front == nullptr)
-        {
-            rear = nullptr;
-        }
-
-        delete temp; // Free the memory of the old front node
-        count--;
-        std::cout << item << " has been dequeued." << std::endl;
-        return item;
-    }
-
-    // Gets the front element without removing it
-    T getFront() const
-    {
-        if (isEmpty())
-        {
-            throw std::runtime_error("Error: Queue is empty.");
-        }
-        return front->data;
-    }
-
-    // Displays all elements in the queue
-    void display() const
-    {
-        if (isEmpty())
-        {
-            std::cout << "Queue is empty." << std::endl;
-            return;
-        }
-        std::cout << "Queue elements (from front to rear): ";
-        Node<T> *current = front;
-        while (current != nullptr)
-        {
-            std::cout << current->data << " ";
-            current = current->next;
-        }
-        std::cout << std::endl;
-    }
-};
+#include <stdexcept> // For std::runtime_error
+#include <string>
+#include "LinkedQueue.h"
 
 // main function to test the LinkedQueue class
 int main()
@@ -137,7 +20,7 @@ int main()
     std::cout << "Current queue size: " << q.size() << std::endl;
 
     std::cout << "\n--- Testing dequeue operation ---" << std::endl;
-    q.dequeue();
+    std::cout << q.dequeue() << " has been dequeued." << std::endl;
     q.display();
 
     try
@@ -157,21 +40,16 @@ int main()
 
     std::cout << "Current queue size: " << q.size() << std::endl;
 
-    std::cout << "\n--- Dequeueing all elements ---" << std::endl;
-    try
-    {
-        while (!q.isEmpty())
-        {
-            q.dequeue();
-        }
-    }
-    catch (const std::runtime_error &e)
+    std::cout << "\n--- Dequeueing all elements with try_dequeue ---" << std::endl;
+    int item;
+    while (q.try_dequeue(item))
     {
-        std::cerr << e.what() << std::endl;
+        std::cout << item << " has been dequeued." << std::endl;
     }
     q.display();
 
     std::cout << "\n--- Testing dequeue on an empty queue ---" << std::endl;
+    std::cout << "try_dequeue: " << (q.try_dequeue(item) ? "Success" : "Failed (Correct)") << std::endl;
     try
     {
         q.dequeue(); // This will throw an exception
@@ -181,5 +59,26 @@ int main()
         std::cerr << e.what() << std::endl;
     }
 
+    std::cout << "\n--- Testing move-aware enqueue and emplace ---" << std::endl;
+    LinkedQueue<std::string> words;
+    std::string long_word(40, 'a');
+    words.enqueue(std::move(long_word));
+    std::cout << "Source string after a moving enqueue is empty: " << (long_word.empty() ? "Yes" : "No") << std::endl;
+    words.emplace(5, 'z'); // Built in the node from (count, char)
+    std::string first;
+    words.try_dequeue(first);
+    std::cout << "Dequeued string of length " << first.size() << std::endl;
+
+    std::cout << "\n--- Testing node recycling ---" << std::endl;
+    LinkedQueue<int> recycled;
+    int *slot = &recycled.emplace(1);
+    bool reused = true;
+    for (int k = 2; k <= 4; ++k)
+    {
+        recycled.dequeue(); // The node goes onto the pool's free list...
+        reused = reused && &recycled.emplace(k) == slot; // ...and is taken back here
+    }
+    std::cout << "Every enqueue reused the dequeued node: " << (reused ? "Yes (Correct)" : "No") << std::endl;
+
     return 0;
-}
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#ifndef LINKEDQUEUE_H
+#define LINKEDQUEUE_H
+
+#include <iostream>
+#include <stdexcept> // For throwing exceptions
+#include <new>       // For placement new, std::bad_alloc
+#include <utility>   // For std::move, std::forward
+#include "../01LinearList/NodePool.h"
+
+// A generic Node for the linked list
+template <typename T>
+struct Node
+{
+    T data;
+    Node *next;
+
+    // Node constructor: builds data from any of T's constructor arguments
+    template <typename... Args>
+    explicit Node(Args &&...args) : data(std::forward<Args>(args)...), next(nullptr) {}
+};
+
+// A generic linked list based queue template class
+// NodeAlloc is the node allocation policy from NodePool.h. The default NodePool
+// puts dequeued nodes on a free list and enqueue takes them back first, so a
+// queue whose length stays bounded stops allocating after warm-up;
+// HeapNodeAlloc gives the plain new/delete per node.
+template <typename T, template <typename> class NodeAlloc = NodePool>
+class LinkedQueue
+{
+private:
+    Node<T> *front;           // Pointer to the front of the queue
+    Node<T> *rear;            // Pointer to the rear of the queue
+    int count;                // Current number of elements in the queue
+    NodeAlloc<Node<T>> nodes; // Supplies and recycles node storage
+
+    // Destroys every element and hands all nodes back to the policy
+    void clear()
+    {
+        Node<T> *current = front;
+        while (current != nullptr)
+        {
+            Node<T> *temp = current;
+            current = current->next;
+            temp->~Node<T>();
+            if (!NodeAlloc<Node<T>>::kBulkRelease)
+            {
+                nodes.Deallocate(temp);
+            }
+        }
+        if (NodeAlloc<Node<T>>::kBulkRelease)
+        {
+            nodes.ReleaseAll(); // The pool takes back all nodes at once
+        }
+        front = rear = nullptr;
+        count = 0;
+    }
+
+    // Unlinks and recycles the front node (the queue must not be empty)
+    void popFront()
+    {
+        Node<T> *temp = front; // Temporarily store the front node
+        front = front->next;   // Move front to the next node
+
+        // If the queue becomes empty after dequeue, update rear as well
+        if (front == nullptr)
+        {
+            rear = nullptr;
+        }
+
+        temp->~Node<T>();
+        nodes.Deallocate(temp); // The node goes back to the free list
+        count--;
+    }
+
+public:
+    // Constructor: initializes an empty queue
+    LinkedQueue() : front(nullptr), rear(nullptr), count(0) {}
+
+    // Destructor: frees all allocated memory
+    // Elements are destroyed in place rather than copied out through dequeue()
+    ~LinkedQueue()
+    {
+        clear();
+    }
+
+    LinkedQueue(const LinkedQueue &) = delete;
+    LinkedQueue &operator=(const LinkedQueue &) = delete;
+
+    // Checks if the queue is empty
+    bool isEmpty() const
+    {
+        return front == nullptr;
+    }
+
+    // Gets the current size of the queue
+    int size() const
+    {
+        return count;
+    }
+
+    // Constructs an element at the rear of the queue from 'args' (no copy)
+    template <typename... Args>
+    T &emplace(Args &&...args)
+    {
+        void *mem = nodes.Allocate(); // A recycled node if one is free
+        if (mem == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        Node<T> *newNode = new (mem) Node<T>(std::forward<Args>(args)...);
+        if (isEmpty())
+        {
+            front = rear = newNode; // The new node is both front and rear
+        }
+        else
+        {
+            rear->next = newNode; // Link the old rear to the new node
+            rear = newNode;       // Update the rear pointer
+        }
+        count++;
+        return newNode->data;
+    }
+
+    // Adds an element to the rear of the queue (enqueue)
+    void enqueue(const T &item)
+    {
+        emplace(item);
+    }
+
+    // Adds an element to the rear of the queue, moving from 'item'
+    void enqueue(T &&item)
+    {
+        emplace(std::move(item));
+    }
+
+    // Moves the front element into 'out'; returns false if the queue is empty
+    bool try_dequeue(T &out)
+    {
+        if (isEmpty())
+        {
+            return false;
+        }
+        out = std::move(front->data);
+        popFront();
+        return true;
+    }
+
+    // Removes an element from the front of the queue (dequeue)
+    T dequeue()
+    {
+        if (isEmpty())
+        {
+            throw std::runtime_error("Error: Queue is empty. Cannot dequeue.");
+        }
+        T item = std::move(front->data); // Move the data out of the front node
+        popFront();
+        return item;
+    }
+
+    // Gets the front element without removing it
+    T getFront() const
+    {
+        if (isEmpty())
+        {
+            throw std::runtime_error("Error: Queue is empty.");
+        }
+        return front->data;
+    }
+
+    // Displays all elements in the queue
+    void display() const
+    {
+        if (isEmpty())
+        {
+            std::cout << "Queue is empty." << std::endl;
+            return;
+        }
+        std::cout << "Queue elements (from front to rear): ";
+        Node<T> *current = front;
+        while (current != nullptr)
+        {
+            std::cout << current->data << " ";
+            current = current->next;
+        }
+        std::cout << std::endl;
+    }
+};
+
+#endif // LINKEDQUEUE_H
@@ -0,0 +1,83 @@
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <atomic>
+#include "MPMCQueue.h"
+
+// main function to test the MPMCQueue class
+int main()
+{
+    std::cout << "--- Creating an MPMC queue with requested capacity 4 ---" << std::endl;
+    MPMCQueue<int> q(4);
+    std::cout << "Actual capacity (power of two): " << q.getCapacity() << std::endl;
+
+    std::cout << "\n--- Testing try_enqueue until the queue is full ---" << std::endl;
+    int next = 10;
+    while (q.try_enqueue(next))
+    {
+        next += 10;
+    }
+    std::cout << "Enqueued " << q.size() << " elements. Is the queue full? " << (q.isFull() ? "Yes" : "No") << std::endl;
+
+    std::cout << "\n--- Testing the 'fake overflow' case of ArrayQueue ---" << std::endl;
+    int item;
+    q.try_dequeue(item);
+    std::cout << item << " has been dequeued." << std::endl;
+    std::cout << "Enqueue 50 after a dequeue: " << (q.try_enqueue(50) ? "Success (Correct)" : "Failed") << std::endl;
+    std::cout << "Remaining elements: ";
+    while (q.try_dequeue(item))
+    {
+        std::cout << item << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "Dequeue on an empty queue: " << (q.try_dequeue(item) ? "Success" : "Failed (Correct)") << std::endl;
+
+    std::cout << "\n--- Testing move-only payloads (std::string) ---" << std::endl;
+    MPMCQueue<std::string> words(2);
+    std::string w = "circular";
+    words.enqueue(std::move(w));
+    words.enqueue("queue");
+    std::cout << "Dequeued: " << words.dequeue() << " " << words.dequeue() << std::endl;
+
+    std::cout << "\n--- Blocking dequeue waits for a late producer ---" << std::endl;
+    MPMCQueue<int> handoff(2);
+    std::thread late([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        handoff.enqueue(42);
+    });
+    std::cout << "Blocking dequeue returned " << handoff.dequeue() << std::endl;
+    late.join();
+
+    std::cout << "\n--- 4 producers and 4 consumers through a queue of 8 ---" << std::endl;
+    const int kProducers = 4, kConsumers = 4, kPerProducer = 200000;
+    MPMCQueue<int> shared(8);
+    std::vector<std::atomic<int>> seen(kProducers * kPerProducer);
+    for (std::atomic<int> &s : seen)
+        s.store(0);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < kProducers; ++p)
+    {
+        threads.emplace_back([&, p]() {
+            for (int k = 0; k < kPerProducer; ++k)
+                shared.enqueue(p * kPerProducer + k);
+        });
+    }
+    for (int c = 0; c < kConsumers; ++c)
+    {
+        threads.emplace_back([&]() {
+            for (int k = 0; k < kProducers * kPerProducer / kConsumers; ++k)
+                seen[shared.dequeue()].fetch_add(1);
+        });
+    }
+    for (std::thread &t : threads)
+        t.join();
+    bool exactly_once = true;
+    for (std::atomic<int> &s : seen)
+        exactly_once = exactly_once && s.load() == 1;
+    std::cout << "Every item dequeued exactly once: " << (exactly_once ? "Yes (Correct)" : "No") << std::endl;
+    std::cout << "Queue is empty afterwards: " << (shared.isEmpty() ? "Yes (Correct)" : "No") << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,314 @@
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include <atomic>
+#include <cstddef> // For std::size_t
+#include <cstdint> // For std::uint32_t
+#include <new>     // For ::operator new
+#include <thread>  // For std::this_thread::yield
+#include <utility> // For std::move
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// FutexWait: Sleeps while 'word' still holds 'expected' (may wake spuriously).
+inline void FutexWait(std::atomic<std::uint32_t> &word, std::uint32_t expected)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#elif defined(__cpp_lib_atomic_wait)
+    word.wait(expected);
+#else
+    if (word.load() == expected)
+        std::this_thread::yield();
+#endif
+}
+
+// FutexWake: Wakes up to 'n' threads sleeping on 'word'.
+inline void FutexWake(std::atomic<std::uint32_t> &word, int n)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE_PRIVATE, n, nullptr, nullptr, 0);
+#elif defined(__cpp_lib_atomic_wait)
+    if (n == 1)
+        word.notify_one();
+    else
+        word.notify_all();
+#else
+    (void)word;
+    (void)n;
+#endif
+}
+
+const int MPMC_SPIN_BEFORE_SLEEP = 64; // Yielding retries before a blocking call sleeps
+
+/**
+ * @class MPMCQueue
+ * @brief A bounded circular queue shared by any number of producer and
+ * consumer threads (Vyukov's array queue).
+ *
+ * Every slot carries a sequence number that says whose turn it is:
+ *   - seq == pos             the slot is free for the producer that claims 'pos'
+ *   - seq == pos + 1         the slot holds the element for the consumer at 'pos'
+ *   - seq == pos + capacity  the slot was emptied and is ready for the next lap
+ * A thread claims a position by advancing rear (or front) with a CAS, then
+ * owns that slot alone, so producers and consumers only contend on their own
+ * index and never on a shared count. Unlike ArrayQueue, positions wrap around,
+ * so the queue never becomes "full" after dequeues.
+ *
+ * try_enqueue/try_dequeue never block. enqueue/dequeue sleep on a futex while
+ * the queue is full/empty and are woken by the other side; the wake-up system
+ * call is skipped whenever nobody sleeps.
+ */
+template <typename T>
+class MPMCQueue
+{
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> seq;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *Data() { return reinterpret_cast<T *>(storage); }
+    };
+
+    // Sleep/wake state for one side (threads waiting for "not empty" or "not full").
+    struct alignas(64) WaitPoint
+    {
+        std::atomic<std::uint32_t> epoch;   // Bumped on every wake-up; the futex word
+        std::atomic<std::uint32_t> waiters; // Threads that are (about to be) asleep
+    };
+
+    Cell *cells;
+    std::size_t capacity; // Power of two
+    std::size_t mask;     // capacity - 1
+
+    alignas(64) std::atomic<std::size_t> rear;  // Next position to claim for enqueue
+    alignas(64) std::atomic<std::size_t> front; // Next position to claim for dequeue
+    WaitPoint not_empty;                        // Consumers sleep here
+    WaitPoint not_full;                         // Producers sleep here
+
+    // ClaimWrite: Claims a free slot for enqueue; returns nullptr if the queue is full.
+    Cell *ClaimWrite(std::size_t &pos)
+    {
+        pos = rear.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell *cell = &cells[pos & mask];
+            std::size_t seq = cell->seq.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0)
+            {
+                if (rear.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    return cell;
+            }
+            else if (diff < 0)
+            {
+                return nullptr; // The slot still holds last lap's element
+            }
+            else
+            {
+                pos = rear.load(std::memory_order_relaxed); // Another producer took it
+            }
+        }
+    }
+
+    // ClaimRead: Claims a filled slot for dequeue; returns nullptr if the queue is empty.
+    Cell *ClaimRead(std::size_t &pos)
+    {
+        pos = front.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell *cell = &cells[pos & mask];
+            std::size_t seq = cell->seq.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+            if (diff == 0)
+            {
+                if (front.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    return cell;
+            }
+            else if (diff < 0)
+            {
+                return nullptr; // No producer has filled this slot yet
+            }
+            else
+            {
+                pos = front.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Publishes a written slot to consumers.
+    void FinishWrite(Cell *cell, std::size_t pos)
+    {
+        cell->seq.store(pos + 1, std::memory_order_release);
+        Wake(not_empty);
+    }
+
+    // Hands an emptied slot to the producer of the next lap.
+    void FinishRead(Cell *cell, std::size_t pos)
+    {
+        cell->Data()->~T();
+        cell->seq.store(pos + capacity, std::memory_order_release);
+        Wake(not_full);
+    }
+
+    // Wake: Wakes one sleeper, but only pays for the system call if someone sleeps.
+    // The fence pairs with the one in Sleep: either the waiter sees our slot
+    // update on its re-check, or we see its waiters increment here.
+    static void Wake(WaitPoint &wp)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (wp.waiters.load(std::memory_order_relaxed) != 0)
+        {
+            wp.epoch.fetch_add(1, std::memory_order_release);
+            FutexWake(wp.epoch, 1);
+        }
+    }
+
+    // Sleep: Retries 'claim' until it succeeds and returns the claimed cell.
+    // The first retries only yield, since the other side usually catches up
+    // within a few time slices; after that the thread registers as a waiter
+    // on 'wp' and sleeps on the futex.
+    template <typename Claim>
+    Cell *Sleep(WaitPoint &wp, Claim claim, std::size_t &pos)
+    {
+        for (int spin = 0; spin < MPMC_SPIN_BEFORE_SLEEP; ++spin)
+        {
+            std::this_thread::yield();
+            Cell *cell = claim(pos);
+            if (cell != nullptr)
+                return cell;
+        }
+        while (true)
+        {
+            std::uint32_t epoch = wp.epoch.load(std::memory_order_acquire);
+            wp.waiters.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            Cell *cell = claim(pos);
+            if (cell == nullptr)
+                FutexWait(wp.epoch, epoch);
+            wp.waiters.fetch_sub(1, std::memory_order_relaxed);
+            if (cell != nullptr || (cell = claim(pos)) != nullptr)
+                return cell;
+        }
+    }
+
+public:
+    // Constructor: rounds 'size' up to the next power of two (at least 2).
+    explicit MPMCQueue(std::size_t size)
+    {
+        capacity = 2;
+        while (capacity < size)
+            capacity <<= 1;
+        mask = capacity - 1;
+        cells = static_cast<Cell *>(::operator new(sizeof(Cell) * capacity));
+        for (std::size_t i = 0; i < capacity; ++i)
+            new (&cells[i].seq) std::atomic<std::size_t>(i);
+        rear.store(0);
+        front.store(0);
+        not_empty.epoch.store(0);
+        not_empty.waiters.store(0);
+        not_full.epoch.store(0);
+        not_full.waiters.store(0);
+    }
+
+    // Destructor: destroys the remaining elements. No thread may still use the queue.
+    ~MPMCQueue()
+    {
+        for (std::size_t pos = front.load(); pos != rear.load(); ++pos)
+            cells[pos & mask].Data()->~T();
+        ::operator delete(cells);
+    }
+
+    MPMCQueue(const MPMCQueue &) = delete;
+    MPMCQueue &operator=(const MPMCQueue &) = delete;
+
+    std::size_t getCapacity() const { return capacity; }
+
+    // Approximate while other threads are active.
+    std::size_t size() const
+    {
+        std::size_t f = front.load(std::memory_order_acquire);
+        std::size_t r = rear.load(std::memory_order_acquire);
+        return r > f ? r - f : 0;
+    }
+    bool isEmpty() const { return size() == 0; }
+    bool isFull() const { return size() >= capacity; }
+
+    // --- Non-blocking ---
+
+    // Adds an element at the rear; returns false if the queue is full.
+    bool try_enqueue(const T &item)
+    {
+        std::size_t pos;
+        Cell *cell = ClaimWrite(pos);
+        if (cell == nullptr)
+            return false;
+        new (cell->Data()) T(item);
+        FinishWrite(cell, pos);
+        return true;
+    }
+
+    bool try_enqueue(T &&item)
+    {
+        std::size_t pos;
+        Cell *cell = ClaimWrite(pos);
+        if (cell == nullptr)
+            return false;
+        new (cell->Data()) T(std::move(item));
+        FinishWrite(cell, pos);
+        return true;
+    }
+
+    // Removes the front element into 'item'; returns false if the queue is empty.
+    bool try_dequeue(T &item)
+    {
+        std::size_t pos;
+        Cell *cell = ClaimRead(pos);
+        if (cell == nullptr)
+            return false;
+        item = std::move(*cell->Data());
+        FinishRead(cell, pos);
+        return true;
+    }
+
+    // --- Blocking ---
+
+    // Adds an element at the rear, sleeping while the queue is full.
+    void enqueue(const T &item)
+    {
+        std::size_t pos;
+        Cell *cell = ClaimWrite(pos);
+        if (cell == nullptr)
+            cell = Sleep(not_full, [this](std::size_t &p) { return ClaimWrite(p); }, pos);
+        new (cell->Data()) T(item);
+        FinishWrite(cell, pos);
+    }
+
+    void enqueue(T &&item)
+    {
+        std::size_t pos;
+        Cell *cell = ClaimWrite(pos);
+        if (cell == nullptr)
+            cell = Sleep(not_full, [this](std::size_t &p) { return ClaimWrite(p); }, pos);
+        new (cell->Data()) T(std::move(item));
+        FinishWrite(cell, pos);
+    }
+
+    // Removes and returns the front element, sleeping while the queue is empty.
+    T dequeue()
+    {
+        std::size_t pos;
+        Cell *cell = ClaimRead(pos);
+        if (cell == nullptr)
+            cell = Sleep(not_empty, [this](std::size_t &p) { return ClaimRead(p); }, pos);
+        T item(std::move(*cell->Data()));
+        FinishRead(cell, pos);
+        return item;
+    }
+};
+
+#endif // MPMCQUEUE_H
@@ -0,0 +1,157 @@
+#include <iostream>
+#include <iomanip> // For std::setw
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include "MPMCQueue.h"
+
+/**
+ * Contention benchmark: MPMCQueue vs a circular queue behind a mutex.
+ * P producers push kItems integers in total through a queue of kCapacity
+ * slots while C consumers pop them. MPMCQueue is run twice: once with the
+ * blocking enqueue/dequeue (futex sleep) and once with try_* plus yield,
+ * which is what callers without blocking support would write. The table
+ * reports millions of items per second; the sum of everything consumed is
+ * compared against the sum produced.
+ */
+
+const int kItems = 2000000;
+const int kCapacity = 1024;
+
+// CircularArrayQueue's ring with every call serialized by one mutex; full and
+// empty are waited out on condition variables.
+class MutexCircularQueue
+{
+private:
+    std::mutex lock;
+    std::condition_variable not_empty, not_full;
+    std::vector<int> arr;
+    int front, rear, count;
+
+public:
+    MutexCircularQueue(int size) : arr(size), front(0), rear(0), count(0) {}
+
+    void enqueue(int item)
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        not_full.wait(guard, [this]() { return count < static_cast<int>(arr.size()); });
+        arr[rear] = item;
+        rear = (rear + 1) % arr.size();
+        count++;
+        guard.unlock();
+        not_empty.notify_one();
+    }
+
+    int dequeue()
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        not_empty.wait(guard, [this]() { return count > 0; });
+        int item = arr[front];
+        front = (front + 1) % arr.size();
+        count--;
+        guard.unlock();
+        not_full.notify_one();
+        return item;
+    }
+};
+
+// MPMCQueue used only through its non-blocking calls.
+class SpinningMPMCQueue
+{
+private:
+    MPMCQueue<int> q;
+
+public:
+    SpinningMPMCQueue(int size) : q(size) {}
+
+    void enqueue(int item)
+    {
+        while (!q.try_enqueue(item))
+            std::this_thread::yield();
+    }
+
+    int dequeue()
+    {
+        int item;
+        while (!q.try_dequeue(item))
+            std::this_thread::yield();
+        return item;
+    }
+};
+
+// Run: Moves kItems through 'queue' with the given thread counts.
+// Returns items per second; 'sum' receives the sum of all dequeued items.
+template <typename Queue>
+double Run(Queue &queue, int producers, int consumers, long long &sum)
+{
+    std::atomic<bool> go(false);
+    std::atomic<long long> total(0);
+    std::vector<std::thread> threads;
+    int per_producer = kItems / producers;
+    int per_consumer = kItems / consumers;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&, p]() {
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            for (int k = 0; k < per_producer; ++k)
+                queue.enqueue(p * per_producer + k);
+        });
+    }
+    for (int c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back([&]() {
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            long long mine = 0;
+            for (int k = 0; k < per_consumer; ++k)
+                mine += queue.dequeue();
+            total.fetch_add(mine);
+        });
+    }
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread &t : threads)
+        t.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    sum = total.load();
+    return kItems / seconds;
+}
+
+int main()
+{
+    std::cout << "--- MPMCQueue Contention Benchmark ---" << std::endl;
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << kItems << " items through " << kCapacity << " slots, million items/sec" << std::endl;
+    std::cout << "\n"
+              << std::setw(10) << "producers" << std::setw(10) << "consumers"
+              << std::setw(16) << "MPMC blocking" << std::setw(16) << "MPMC try+yield"
+              << std::setw(16) << "mutex+condvar" << std::endl;
+
+    // kItems is divisible by every count below, so all items are consumed.
+    const int configs[][2] = {{1, 1}, {1, 4}, {4, 1}, {2, 2}, {4, 4}, {8, 8}, {16, 16}};
+    const long long expected = static_cast<long long>(kItems) * (kItems - 1) / 2;
+    for (const int *cfg : configs)
+    {
+        int producers = cfg[0], consumers = cfg[1];
+        long long sum_blocking = 0, sum_spinning = 0, sum_mutex = 0;
+
+        MPMCQueue<int> blocking(kCapacity);
+        double b = Run(blocking, producers, consumers, sum_blocking);
+        SpinningMPMCQueue spinning(kCapacity);
+        double s = Run(spinning, producers, consumers, sum_spinning);
+        MutexCircularQueue locked(kCapacity);
+        double m = Run(locked, producers, consumers, sum_mutex);
+
+        std::cout << std::fixed << std::setprecision(2) << std::setw(10) << producers << std::setw(10) << consumers
+                  << std::setw(16) << b / 1e6 << std::setw(16) << s / 1e6 << std::setw(16) << m / 1e6 << std::endl;
+        if (sum_blocking != expected || sum_spinning != expected || sum_mutex != expected)
+            std::cout << "Mismatch: an item was lost or duplicated!" << std::endl;
+    }
+
+    std::cout << "\n--- Benchmark Complete ---" << std::endl;
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include "SPSCQueue.h"
+
+// main function to test the SPSCQueue class
+int main()
+{
+    std::cout << "--- Creating an SPSC queue with requested capacity 5 ---" << std::endl;
+    SPSCQueue<int> q(5);
+    std::cout << "Actual capacity (power of two): " << q.getCapacity() << std::endl;
+
+    std::cout << "\n--- Testing enqueue until the queue is full ---" << std::endl;
+    int next = 10;
+    while (q.try_enqueue(next))
+    {
+        next += 10;
+    }
+    std::cout << "Enqueued " << q.size() << " elements. Is the queue full? " << (q.isFull() ? "Yes" : "No") << std::endl;
+
+    std::cout << "\n--- Testing dequeue and wrap-around ---" << std::endl;
+    int item;
+    q.try_dequeue(item);
+    std::cout << item << " has been dequeued." << std::endl;
+    q.try_dequeue(item);
+    std::cout << item << " has been dequeued." << std::endl;
+    std::cout << "Enqueue 90 after wrap-around: " << (q.try_enqueue(90) ? "Success" : "Failed") << std::endl;
+
+    std::cout << "\n--- Testing batch operations ---" << std::endl;
+    int batch[] = {100, 110, 120};
+    std::size_t added = q.enqueue_n(batch, 3);
+    std::cout << "enqueue_n accepted " << added << " of 3 (one free slot)." << std::endl;
+    int out[16];
+    std::size_t taken = q.dequeue_n(out, 16);
+    std::cout << "dequeue_n returned " << taken << " elements: ";
+    for (std::size_t k = 0; k < taken; ++k)
+    {
+        std::cout << out[k] << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "Dequeue on an empty queue: " << (q.try_dequeue(item) ? "Success" : "Failed (Correct)") << std::endl;
+
+    std::cout << "\n--- Producer/consumer hand-off across two threads ---" << std::endl;
+    const long long kItems = 20000000;
+    const std::size_t kBatch = 64;
+    SPSCQueue<long long> channel(1 << 16);
+    bool in_order = true;
+    auto start = std::chrono::steady_clock::now();
+    std::thread consumer([&]() {
+        long long expected = 0;
+        long long buf[kBatch];
+        while (expected < kItems)
+        {
+            std::size_t n = channel.dequeue_n(buf, kBatch);
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                in_order = in_order && buf[k] == expected;
+                expected++;
+            }
+            if (n == 0)
+                std::this_thread::yield();
+        }
+    });
+    long long buf[kBatch];
+    for (long long sent = 0; sent < kItems;)
+    {
+        std::size_t n = 0;
+        for (; n < kBatch && sent + static_cast<long long>(n) < kItems; ++n)
+            buf[n] = sent + n;
+        std::size_t done = 0;
+        while (done < n)
+        {
+            std::size_t k = channel.enqueue_n(buf + done, n - done);
+            if (k == 0)
+                std::this_thread::yield();
+            done += k;
+        }
+        sent += n;
+    }
+    consumer.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Transferred " << kItems << " items in order: " << (in_order ? "Yes (Correct)" : "No") << std::endl;
+    std::cout << "Throughput: " << kItems / seconds / 1e6 << " million items/sec" << std::endl;
+
+    return 0;
+}
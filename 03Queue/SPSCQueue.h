@@ -0,0 +1,162 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef> // For std::size_t
+#include <new>     // For ::operator new
+#include <utility> // For std::move
+
+/**
+ * @class SPSCQueue
+ * @brief A bounded single-producer/single-consumer circular queue.
+ * Based on CircularArrayQueue, with the changes needed to hand items from one
+ * thread to another without locks:
+ *   - The capacity is rounded up to a power of two, so a slot is found with
+ *     'index & mask' instead of '% capacity'.
+ *   - There is no shared count. front and rear run freely, and
+ *     rear - front is the number of elements.
+ *   - front (written only by the consumer) and rear (written only by the
+ *     producer) sit on separate cache lines. Each side also keeps a cached
+ *     copy of the other side's index and rereads the shared one only when the
+ *     cached copy makes the queue look full (or empty).
+ * Every operation finishes in a bounded number of steps (wait-free).
+ * Exactly one thread may enqueue and exactly one thread may dequeue.
+ */
+template <typename T>
+class SPSCQueue
+{
+private:
+    T *arr;               // Ring storage, capacity slots
+    std::size_t capacity; // Power of two
+    std::size_t mask;     // capacity - 1
+
+    // Consumer side
+    alignas(64) std::atomic<std::size_t> front; // Next slot to read
+    std::size_t cached_rear;                    // Consumer's last view of rear
+
+    // Producer side
+    alignas(64) std::atomic<std::size_t> rear; // Next slot to write
+    std::size_t cached_front;                  // Producer's last view of front
+
+    // Returns true if the producer can write 'n' more slots.
+    bool HasRoom(std::size_t r, std::size_t n)
+    {
+        if (r - cached_front + n <= capacity)
+            return true;
+        cached_front = front.load(std::memory_order_acquire);
+        return r - cached_front + n <= capacity;
+    }
+
+    // Returns how many slots the consumer can read, refreshing its cached
+    // view of rear only if it shows fewer than the 'wanted' elements.
+    std::size_t Available(std::size_t f, std::size_t wanted)
+    {
+        if (cached_rear - f < wanted)
+            cached_rear = rear.load(std::memory_order_acquire);
+        return cached_rear - f;
+    }
+
+public:
+    // Constructor: rounds 'size' up to the next power of two (at least 2).
+    explicit SPSCQueue(std::size_t size)
+    {
+        capacity = 2;
+        while (capacity < size)
+            capacity <<= 1;
+        mask = capacity - 1;
+        arr = static_cast<T *>(::operator new(sizeof(T) * capacity));
+        front.store(0);
+        rear.store(0);
+        cached_front = 0;
+        cached_rear = 0;
+    }
+
+    // Destructor: destroys the remaining elements and frees the ring.
+    ~SPSCQueue()
+    {
+        for (std::size_t f = front.load(); f != rear.load(); ++f)
+            arr[f & mask].~T();
+        ::operator delete(arr);
+    }
+
+    SPSCQueue(const SPSCQueue &) = delete;
+    SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+    std::size_t getCapacity() const { return capacity; }
+
+    // Approximate when called while the other thread is active.
+    std::size_t size() const { return rear.load(std::memory_order_acquire) - front.load(std::memory_order_acquire); }
+    bool isEmpty() const { return size() == 0; }
+    bool isFull() const { return size() == capacity; }
+
+    // --- Producer side ---
+
+    // Adds an element at the rear; returns false if the queue is full.
+    bool try_enqueue(const T &item)
+    {
+        std::size_t r = rear.load(std::memory_order_relaxed);
+        if (!HasRoom(r, 1))
+            return false;
+        new (arr + (r & mask)) T(item);
+        rear.store(r + 1, std::memory_order_release); // Publish the element
+        return true;
+    }
+
+    bool try_enqueue(T &&item)
+    {
+        std::size_t r = rear.load(std::memory_order_relaxed);
+        if (!HasRoom(r, 1))
+            return false;
+        new (arr + (r & mask)) T(std::move(item));
+        rear.store(r + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Adds up to n elements from src with a single publish; returns how many fit.
+    std::size_t enqueue_n(const T *src, std::size_t n)
+    {
+        std::size_t r = rear.load(std::memory_order_relaxed);
+        if (!HasRoom(r, n))
+            n = capacity - (r - cached_front); // Only what fits
+        for (std::size_t k = 0; k < n; ++k)
+            new (arr + ((r + k) & mask)) T(src[k]);
+        if (n > 0)
+            rear.store(r + n, std::memory_order_release);
+        return n;
+    }
+
+    // --- Consumer side ---
+
+    // Removes the front element into 'item'; returns false if the queue is empty.
+    bool try_dequeue(T &item)
+    {
+        std::size_t f = front.load(std::memory_order_relaxed);
+        if (Available(f, 1) == 0)
+            return false;
+        T *slot = arr + (f & mask);
+        item = std::move(*slot);
+        slot->~T();
+        front.store(f + 1, std::memory_order_release); // Hand the slot back
+        return true;
+    }
+
+    // Removes up to n elements into dst with a single release; returns how many.
+    std::size_t dequeue_n(T *dst, std::size_t n)
+    {
+        std::size_t f = front.load(std::memory_order_relaxed);
+        std::size_t avail = Available(f, n);
+        if (n > avail)
+            n = avail;
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            T *slot = arr + ((f + k) & mask);
+            dst[k] = std::move(*slot);
+            slot->~T();
+        }
+        if (n > 0)
+            front.store(f + n, std::memory_order_release);
+        return n;
+    }
+};
+
+#endif // SPSCQUEUE_H
@@ -0,0 +1,113 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm> // For std::sort
+#include "StringMatch.h"
+#include "AhoCorasick.h"
+
+// Sorts matches by (offset, pattern_id) so different scans can be compared.
+std::vector<AcMatch> sortedMatches(std::vector<AcMatch> matches)
+{
+    std::sort(matches.begin(), matches.end(), [](const AcMatch &a, const AcMatch &b) {
+        return a.offset != b.offset ? a.offset < b.offset : a.pattern_id < b.pattern_id;
+    });
+    return matches;
+}
+
+bool sameMatches(const std::vector<AcMatch> &a, const std::vector<AcMatch> &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        if (a[k].pattern_id != b[k].pattern_id || a[k].offset != b[k].offset)
+            return false;
+    }
+    return true;
+}
+
+int main()
+{
+    std::vector<std::string> P = {"he", "she", "his", "hers"};
+    std::string T = "ushers";
+
+    std::cout << "Target String (T): " << T << std::endl;
+    std::cout << "Patterns (P): he she his hers" << std::endl;
+    std::cout << "------------------------------------------" << std::endl;
+
+    const AcLayout layouts[] = {AcLayout::Dense, AcLayout::DoubleArray};
+    const char *names[] = {"Dense", "DoubleArray"};
+    for (int l = 0; l < 2; ++l)
+    {
+        AhoCorasick ac;
+        for (const std::string &p : P)
+            ac.addPattern(p);
+        ac.build(layouts[l]);
+        std::cout << names[l] << " layout (" << ac.stateCount() << " states, " << ac.memoryBytes() << " bytes):" << std::endl;
+        for (const AcMatch &m : ac.matchAll(T))
+        {
+            std::cout << "  \"" << P[m.pattern_id] << "\" found at index " << m.offset << std::endl;
+        }
+    }
+
+    // --- Cross-check against kmpMatchAll, one pattern at a time ---
+    std::cout << "\nCross-check against kmpMatchAll on random text:" << std::endl;
+    std::mt19937 rng(2025);
+    std::string text(200000, 'a');
+    for (char &c : text)
+        c = static_cast<char>('a' + rng() % 4); // Small alphabet: many overlapping matches
+    std::vector<std::string> patterns;
+    for (int k = 0; k < 300; ++k)
+    {
+        int len = 1 + static_cast<int>(rng() % 8);
+        std::size_t at = rng() % (text.size() - len);
+        patterns.push_back(text.substr(at, len)); // Duplicates are allowed
+    }
+    std::vector<AcMatch> expected;
+    for (int id = 0; id < static_cast<int>(patterns.size()); ++id)
+    {
+        for (int pos : kmpMatchAll(text, patterns[id]))
+            expected.push_back(AcMatch{id, pos});
+    }
+    expected = sortedMatches(expected);
+
+    for (int l = 0; l < 2; ++l)
+    {
+        AhoCorasick ac;
+        for (const std::string &p : patterns)
+            ac.addPattern(p);
+        ac.build(layouts[l]);
+        std::vector<AcMatch> whole = sortedMatches(ac.matchAll(text));
+
+        // The same text fed in random-sized chunks must give the same matches
+        AcStream stream(ac);
+        std::vector<AcMatch> chunked;
+        for (std::size_t pos = 0; pos < text.size();)
+        {
+            std::size_t len = std::min<std::size_t>(1 + rng() % 97, text.size() - pos);
+            stream.feed(text.data() + pos, len, chunked);
+            pos += len;
+        }
+        chunked = sortedMatches(chunked);
+
+        std::cout << "  " << names[l] << ": " << whole.size() << " matches, same as KMP: "
+                  << (sameMatches(whole, expected) ? "Yes" : "No")
+                  << ", streaming in chunks gives the same: " << (sameMatches(chunked, expected) ? "Yes" : "No")
+                  << std::endl;
+    }
+
+    // --- Once built, the automaton is frozen ---
+    AhoCorasick frozen;
+    for (const std::string &p : P)
+        frozen.addPattern(p);
+    frozen.build();
+    std::vector<AcMatch> before = frozen.matchAll(T);
+    bool rejected = frozen.addPattern("us") == -1;
+    frozen.build(AcLayout::DoubleArray); // A second build() must not rebuild
+    std::cout << "\nAfter build(): addPattern rejected: " << (rejected ? "Yes" : "No")
+              << ", second build() keeps the matches: " << (sameMatches(frozen.matchAll(T), before) ? "Yes" : "No")
+              << std::endl;
+
+    return 0;
+}
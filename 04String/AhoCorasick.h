@@ -0,0 +1,423 @@
+#ifndef AHOCORASICK_H
+#define AHOCORASICK_H
+
+#include <string>
+#include <vector>
+#include <cstddef> // For std::size_t
+#include <cstdint> // For std::int32_t
+#include <algorithm> // For std::max
+
+/******************************************************************************
+ * Aho-Corasick Multi-Pattern Matching
+ *
+ * The KMP idea generalized to many patterns at once: the patterns form a trie,
+ * and every trie state gets a failure link to the state of its longest proper
+ * suffix that is also in the trie (the multi-pattern Next table). One pass
+ * over the text then reports every occurrence of every pattern, in
+ * O(n + total pattern length + number of matches).
+ *
+ * After build(), the automaton is stored in one of two layouts:
+ *   - Dense: the complete DFA, delta[state][class], where bytes that occur in
+ *     no pattern share one class (alphabet compression). One table lookup per
+ *     text byte; failure links are folded into the table.
+ *   - DoubleArray: only the trie edges, packed into base/check arrays
+ *     (child of s on class c is t = base[s] + c, valid if check[t] == s).
+ *     Failure links are followed at search time. Much smaller than Dense for
+ *     large pattern sets.
+ * Auto picks Dense while its table stays below AC_DENSE_LIMIT_BYTES.
+ ******************************************************************************/
+
+const std::size_t AC_DENSE_LIMIT_BYTES = 64u << 20; // Largest Dense table Auto accepts
+
+enum class AcLayout
+{
+    Auto,
+    Dense,
+    DoubleArray
+};
+
+// One occurrence: which pattern, and where it starts in the text (or stream).
+struct AcMatch
+{
+    int pattern_id;
+    long long offset;
+};
+
+class AhoCorasick
+{
+private:
+    // --- Construction-time trie ---
+    struct TrieEdge
+    {
+        int cls;   // Byte class of the edge label
+        int child; // Trie node it leads to
+    };
+    struct TrieNode
+    {
+        std::vector<TrieEdge> edges;
+        int fail = 0;
+        int depth = 0;
+    };
+    std::vector<TrieNode> trie;
+    std::vector<int> pattern_length; // Indexed by pattern id
+    std::vector<int> pattern_node;   // Trie node where each pattern ends
+
+    // --- Search-time automaton (indexed by state) ---
+    AcLayout layout;
+    int num_classes;                 // Byte classes, including class 0 ("no pattern uses this byte")
+    unsigned short byte_class[256];  // Byte -> class
+    std::vector<std::int32_t> delta; // Dense: num_states * num_classes transitions
+    std::vector<std::int32_t> base;  // DoubleArray: child of s on c is base[s] + c ...
+    std::vector<std::int32_t> check; // ... if check[base[s] + c] == s
+    std::vector<std::int32_t> fail;  // DoubleArray: failure links
+    std::vector<std::int32_t> out;   // First pattern id ending at this state, or -1
+    std::vector<std::int32_t> dict;  // Nearest state on the failure chain with out != -1, or -1
+    std::vector<std::int32_t> same;  // Next pattern id ending at the same state, or -1
+    bool built;
+
+    int findEdge(int node, int cls) const;
+    void buildFailureLinks(std::vector<int> &order);
+    void compileDense(const std::vector<int> &order);
+    void compileDoubleArray(const std::vector<int> &order);
+    void compileOutputs(const std::vector<int> &state_of);
+
+    // step: Follows one byte class from state s.
+    int step(int s, int c) const
+    {
+        if (layout == AcLayout::Dense)
+            return delta[static_cast<std::size_t>(s) * num_classes + c];
+        while (true)
+        {
+            int t = base[s] + c;
+            if (c != 0 && check[t] == s)
+                return t;
+            if (s == 0)
+                return 0;
+            s = fail[s];
+        }
+    }
+
+public:
+    AhoCorasick();
+
+    // addPattern: Adds a pattern before build(); returns its id (-1 if empty).
+    int addPattern(const std::string &pattern);
+
+    // build: Computes failure links and compiles the chosen layout; does nothing once built.
+    void build(AcLayout requested = AcLayout::Auto);
+
+    int patternCount() const { return static_cast<int>(pattern_length.size()); }
+    int stateCount() const { return static_cast<int>(out.size()); }
+    AcLayout layoutUsed() const { return layout; }
+    std::size_t memoryBytes() const; // Size of the search-time tables
+
+    // scan: Runs the automaton over len bytes starting in 'state'; 'pos' is
+    // the stream offset of data[0]. Calls on_match(pattern_id, offset) for
+    // every occurrence ending inside this buffer and updates 'state'.
+    template <typename OnMatch>
+    void scan(int &state, long long pos, const char *data, std::size_t len, OnMatch on_match) const
+    {
+        int s = state;
+        for (std::size_t i = 0; i < len; ++i)
+        {
+            s = step(s, byte_class[static_cast<unsigned char>(data[i])]);
+            for (int v = out[s] != -1 ? s : dict[s]; v != -1; v = dict[v])
+            {
+                for (int id = out[v]; id != -1; id = same[id])
+                {
+                    on_match(id, pos + static_cast<long long>(i) + 1 - pattern_length[id]);
+                }
+            }
+        }
+        state = s;
+    }
+
+    // matchAll: Every occurrence of every pattern in text, ordered by end position.
+    std::vector<AcMatch> matchAll(const std::string &text) const;
+};
+
+/**
+ * @class AcStream
+ * @brief Feeds a text to an AhoCorasick automaton in chunks.
+ * The automaton state is kept between feed() calls, so a pattern split across
+ * two buffers is still found; offsets count from the start of the stream.
+ */
+class AcStream
+{
+private:
+    const AhoCorasick &ac;
+    int state;
+    long long consumed; // Bytes fed so far
+
+public:
+    explicit AcStream(const AhoCorasick &automaton) : ac(automaton), state(0), consumed(0) {}
+
+    // feed: Scans the next chunk and appends its matches to 'matches'.
+    void feed(const char *data, std::size_t len, std::vector<AcMatch> &matches)
+    {
+        ac.scan(state, consumed, data, len, [&matches](int id, long long offset) {
+            matches.push_back(AcMatch{id, offset});
+        });
+        consumed += static_cast<long long>(len);
+    }
+
+    void feed(const std::string &chunk, std::vector<AcMatch> &matches)
+    {
+        feed(chunk.data(), chunk.size(), matches);
+    }
+
+    // reset: Starts a new stream.
+    void reset()
+    {
+        state = 0;
+        consumed = 0;
+    }
+
+    long long position() const { return consumed; }
+};
+
+// --- Function Implementations ---
+
+inline AhoCorasick::AhoCorasick() : layout(AcLayout::Dense), num_classes(1), built(false)
+{
+    trie.emplace_back(); // Root
+    for (unsigned short &c : byte_class)
+        c = 0;
+}
+
+inline int AhoCorasick::findEdge(int node, int cls) const
+{
+    for (const TrieEdge &e : trie[node].edges)
+    {
+        if (e.cls == cls)
+            return e.child;
+    }
+    return -1;
+}
+
+inline int AhoCorasick::addPattern(const std::string &pattern)
+{
+    if (pattern.empty() || built)
+        return -1;
+    int node = 0;
+    for (char ch : pattern)
+    {
+        unsigned char b = static_cast<unsigned char>(ch);
+        if (byte_class[b] == 0)
+            byte_class[b] = static_cast<unsigned short>(num_classes++); // First use of this byte
+        int cls = byte_class[b];
+        int child = findEdge(node, cls);
+        if (child == -1)
+        {
+            child = static_cast<int>(trie.size());
+            trie[node].edges.push_back(TrieEdge{cls, child});
+            trie.emplace_back();
+            trie[child].depth = trie[node].depth + 1;
+        }
+        node = child;
+    }
+    pattern_length.push_back(static_cast<int>(pattern.size()));
+    pattern_node.push_back(node);
+    return static_cast<int>(pattern_length.size()) - 1;
+}
+
+// buildFailureLinks: BFS over the trie, as computeNextTable does for one
+// pattern: the failure of child (s, c) is goto(fail(s), c), falling back
+// along the failure chain. 'order' receives the nodes in BFS order.
+inline void AhoCorasick::buildFailureLinks(std::vector<int> &order)
+{
+    order.clear();
+    order.push_back(0);
+    for (std::size_t head = 0; head < order.size(); ++head)
+    {
+        int s = order[head];
+        for (const TrieEdge &e : trie[s].edges)
+        {
+            int f = 0;
+            if (s != 0)
+            {
+                f = trie[s].fail;
+                while (f != 0 && findEdge(f, e.cls) == -1)
+                    f = trie[f].fail;
+                int g = findEdge(f, e.cls);
+                f = g != -1 ? g : 0;
+            }
+            trie[e.child].fail = f;
+            order.push_back(e.child);
+        }
+    }
+}
+
+// compileDense: Full DFA. A row starts as a copy of the failure state's row
+// (already complete, since failure states are shallower and come first in BFS
+// order) and is then overwritten with the node's own trie edges.
+inline void AhoCorasick::compileDense(const std::vector<int> &order)
+{
+    std::size_t k = static_cast<std::size_t>(num_classes);
+    delta.assign(trie.size() * k, 0);
+    for (int s : order)
+    {
+        std::int32_t *row = &delta[s * k];
+        if (s != 0)
+        {
+            const std::int32_t *fail_row = &delta[trie[s].fail * k];
+            for (std::size_t c = 0; c < k; ++c)
+                row[c] = fail_row[c];
+        }
+        for (const TrieEdge &e : trie[s].edges)
+            row[e.cls] = e.child;
+    }
+    std::vector<int> identity(trie.size());
+    for (std::size_t s = 0; s < trie.size(); ++s)
+        identity[s] = static_cast<int>(s);
+    compileOutputs(identity);
+}
+
+// compileDoubleArray: Places each node's children so that child c of s sits
+// at base[s] + c, with check[] recording the owner. Slots are claimed first
+// fit, scanning from the first free slot. Class 0 never labels an edge.
+inline void AhoCorasick::compileDoubleArray(const std::vector<int> &order)
+{
+    std::vector<int> state_of(trie.size(), -1); // Trie node -> array index
+    std::size_t cap = trie.size() + static_cast<std::size_t>(num_classes) + 1;
+    base.assign(cap, 0);
+    check.assign(cap, -1);
+    state_of[0] = 0;
+    check[0] = 0; // Root occupies index 0
+    std::size_t first_free = 1;
+
+    for (int node : order)
+    {
+        int s = state_of[node];
+        const std::vector<TrieEdge> &edges = trie[node].edges;
+        if (edges.empty())
+            continue;
+        while (first_free < check.size() && check[first_free] != -1)
+            first_free++;
+        int min_cls = edges[0].cls;
+        for (const TrieEdge &e : edges)
+            min_cls = e.cls < min_cls ? e.cls : min_cls;
+
+        // Smallest b with every b + cls free; b + min_cls starts at the first free slot.
+        long long b = static_cast<long long>(first_free) - min_cls;
+        while (true)
+        {
+            if (b < 1 - min_cls)
+            {
+                b = 1 - min_cls;
+            }
+            bool fits = true;
+            for (const TrieEdge &e : edges)
+            {
+                std::size_t t = static_cast<std::size_t>(b + e.cls);
+                if (t >= check.size())
+                {
+                    check.resize(t + num_classes + 1, -1);
+                    base.resize(check.size(), 0);
+                }
+                if (check[t] != -1)
+                {
+                    fits = false;
+                    break;
+                }
+            }
+            if (fits)
+                break;
+            b++;
+        }
+        base[s] = static_cast<std::int32_t>(b);
+        for (const TrieEdge &e : edges)
+        {
+            std::size_t t = static_cast<std::size_t>(b + e.cls);
+            check[t] = s;
+            state_of[e.child] = static_cast<int>(t);
+        }
+    }
+
+    // Trim the unused tail; base + c must stay inside the arrays for any class.
+    std::size_t used = 1;
+    for (int idx : state_of)
+        used = static_cast<std::size_t>(idx) + 1 > used ? static_cast<std::size_t>(idx) + 1 : used;
+    std::size_t max_base = 0;
+    for (std::size_t t = 0; t < used; ++t)
+        max_base = check[t] != -1 && static_cast<std::size_t>(base[t]) > max_base ? base[t] : max_base;
+    std::size_t keep = std::max(used, max_base + num_classes);
+    check.resize(keep, -1);
+    base.resize(keep, 0);
+
+    fail.assign(keep, 0);
+    for (std::size_t node = 0; node < trie.size(); ++node)
+        fail[state_of[node]] = state_of[trie[node].fail];
+    compileOutputs(state_of);
+}
+
+// compileOutputs: out/same list the patterns ending at each state; dict links
+// each state to the nearest failure-chain state that has an output.
+inline void AhoCorasick::compileOutputs(const std::vector<int> &state_of)
+{
+    std::size_t states = layout == AcLayout::Dense ? trie.size() : check.size();
+    out.assign(states, -1);
+    dict.assign(states, -1);
+    same.assign(pattern_length.size(), -1);
+    for (int id = static_cast<int>(pattern_length.size()) - 1; id >= 0; --id)
+    {
+        int s = state_of[pattern_node[id]];
+        same[id] = out[s];
+        out[s] = id; // Lower ids are reported first
+    }
+    // BFS order again: a node's failure state is shallower, so its dict is final.
+    std::vector<int> order;
+    order.push_back(0);
+    for (std::size_t head = 0; head < order.size(); ++head)
+    {
+        int node = order[head];
+        if (node != 0)
+        {
+            int f = trie[node].fail;
+            int fs = state_of[f];
+            dict[state_of[node]] = out[fs] != -1 ? fs : dict[fs];
+        }
+        for (const TrieEdge &e : trie[node].edges)
+            order.push_back(e.child);
+    }
+}
+
+inline void AhoCorasick::build(AcLayout requested)
+{
+    if (built)
+        return; // The construction trie is already gone
+    std::vector<int> order;
+    buildFailureLinks(order);
+    layout = requested;
+    if (layout == AcLayout::Auto)
+    {
+        std::size_t dense_bytes = trie.size() * static_cast<std::size_t>(num_classes) * sizeof(std::int32_t);
+        layout = dense_bytes <= AC_DENSE_LIMIT_BYTES ? AcLayout::Dense : AcLayout::DoubleArray;
+    }
+    if (layout == AcLayout::Dense)
+        compileDense(order);
+    else
+        compileDoubleArray(order);
+    built = true;
+    // The construction trie is no longer needed
+    std::vector<TrieNode>().swap(trie);
+    std::vector<int>().swap(pattern_node);
+}
+
+inline std::size_t AhoCorasick::memoryBytes() const
+{
+    return sizeof(std::int32_t) * (delta.size() + base.size() + check.size() + fail.size() +
+                                   out.size() + dict.size() + same.size() + pattern_length.size());
+}
+
+inline std::vector<AcMatch> AhoCorasick::matchAll(const std::string &text) const
+{
+    std::vector<AcMatch> matches;
+    int state = 0;
+    scan(state, 0, text.data(), text.size(), [&matches](int id, long long offset) {
+        matches.push_back(AcMatch{id, offset});
+    });
+    return matches;
+}
+
+#endif // AHOCORASICK_H
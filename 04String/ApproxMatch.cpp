@@ -0,0 +1,107 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm> // For std::min
+#include <climits>   // For INT_MAX
+#include "StringMatch.h"
+#include "ApproxMatch.h"
+
+// Reference k-mismatch search: compare every window, O(nm).
+std::vector<int> naiveMismatch(const std::string &text, const std::string &pattern, int k)
+{
+    std::vector<int> result;
+    int n = text.size(), m = pattern.size();
+    for (int i = 0; i + m <= n; ++i)
+    {
+        int mismatches = 0;
+        for (int j = 0; j < m; ++j)
+            mismatches += text[i + j] != pattern[j];
+        if (mismatches <= k)
+            result.push_back(i);
+    }
+    return result;
+}
+
+// Reference edit-distance search (Sellers): full DP column per text character, O(nm).
+std::vector<int> naiveEditEnds(const std::string &text, const std::string &pattern, int k)
+{
+    std::vector<int> result;
+    int m = pattern.size();
+    std::vector<int> col(m + 1), next(m + 1);
+    for (int i = 0; i <= m; ++i)
+        col[i] = i;
+    for (int j = 0; j < static_cast<int>(text.size()); ++j)
+    {
+        next[0] = 0; // A match may start anywhere
+        for (int i = 1; i <= m; ++i)
+        {
+            int sub = col[i - 1] + (pattern[i - 1] != text[j]);
+            next[i] = std::min(sub, std::min(col[i], next[i - 1]) + 1);
+        }
+        col.swap(next);
+        if (col[m] <= k)
+            result.push_back(j);
+    }
+    return result;
+}
+
+int main()
+{
+    std::string T = "the quick brwn fox jumps ovr the lazy dog";
+    std::string P = "brown";
+
+    std::cout << "Target String (T): " << T << std::endl;
+    std::cout << "Pattern String (P): " << P << std::endl;
+    std::cout << "------------------------------------------" << std::endl;
+    std::cout << "Exact Shift-Or: " << shiftOrMatchAll(T, P).size() << " matches" << std::endl;
+    std::cout << "Edit distance <= 1 ends at indices: ";
+    for (int end : myersMatchAll(T, P, 1))
+    {
+        std::cout << end << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "\"lozy\" with <= 1 mismatch starts at indices: ";
+    for (int pos : kMismatchMatchAll(T, "lozy", 1))
+    {
+        std::cout << pos << " ";
+    }
+    std::cout << std::endl;
+
+    // --- Random cross-checks, covering the 64-bit and multiword variants ---
+    std::cout << "\nCross-check against O(nm) references:" << std::endl;
+    std::mt19937 rng(2025);
+    bool exact_ok = true, mismatch_ok = true, edit_ok = true;
+    for (int trial = 0; trial < 1500; ++trial)
+    {
+        int sigma = 2 + rng() % 3;
+        std::string text(rng() % 600, 'a');
+        for (char &c : text)
+            c = static_cast<char>('a' + rng() % sigma);
+        int m = 1 + rng() % (trial % 3 == 0 ? 200 : 64); // Some patterns need several words
+        std::string pattern(m, 'a');
+        if (text.size() > static_cast<std::size_t>(m) && rng() % 2)
+            pattern = text.substr(rng() % (text.size() - m), m);
+        else
+            for (char &c : pattern)
+                c = static_cast<char>('a' + rng() % sigma);
+        for (int k = 0; k < m && k <= 1 + m / 8; ++k)
+        {
+            if (rng() % 3 == 0)
+                pattern[rng() % m] = 'z'; // Force some mismatches
+            mismatch_ok = mismatch_ok && kMismatchMatchAll(text, pattern, k) == naiveMismatch(text, pattern, k) &&
+                          kMismatchMatchAllMultiword(text, pattern, k) == naiveMismatch(text, pattern, k);
+            edit_ok = edit_ok && myersMatchAll(text, pattern, k) == naiveEditEnds(text, pattern, k) &&
+                      myersMatchAllMultiword(text, pattern, k) == naiveEditEnds(text, pattern, k);
+        }
+        int big_k = trial % 2 ? m + static_cast<int>(rng() % 3) : INT_MAX; // k >= m: every window matches
+        mismatch_ok = mismatch_ok && kMismatchMatchAll(text, pattern, big_k) == naiveMismatch(text, pattern, m) &&
+                      kMismatchMatchAllMultiword(text, pattern, big_k) == naiveMismatch(text, pattern, m);
+        exact_ok = exact_ok && shiftOrMatchAll(text, pattern) == kmpMatchAll(text, pattern);
+    }
+    std::cout << "Shift-Or exact same as kmpMatchAll: " << (exact_ok ? "Yes" : "No") << std::endl;
+    std::cout << "k-mismatch same as window comparison: " << (mismatch_ok ? "Yes" : "No") << std::endl;
+    std::cout << "Myers same as DP (edit distance): " << (edit_ok ? "Yes" : "No") << std::endl;
+
+    return 0;
+}
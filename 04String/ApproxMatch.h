@@ -0,0 +1,278 @@
+#ifndef APPROXMATCH_H
+#define APPROXMATCH_H
+
+#include <string_view>
+#include <vector>
+#include <cstddef> // For std::size_t
+#include <cstdint> // For std::uint64_t
+#include <algorithm> // For std::min
+#include "StringMatch.h"
+
+/******************************************************************************
+ * Bit-Parallel Matching (Shift-Or and Myers)
+ *
+ * Both algorithms keep one column of a dynamic-programming table as the bits
+ * of machine words, one bit per pattern position, and update the whole column
+ * with a few word operations per text character: O(n * ceil(m / 64)) instead
+ * of O(nm). Patterns of up to 64 characters use a single uint64_t ("64"
+ * variants); longer ones use an array of words with carries between them
+ * ("Multiword" variants). The plain names pick the right one.
+ *
+ *   - Shift-Or (Bitap): bit i of D is 0 when P[0..i] matches the text ending
+ *     at the current character. k-mismatch search keeps one D per number of
+ *     mismatches d = 0..k.
+ *   - Myers: the edit-distance column is stored as vertical +1/-1 deltas
+ *     (Pv/Mv), and only the score of the last row is tracked explicitly.
+ ******************************************************************************/
+
+const int WORD_BITS = 64;
+
+// buildBitMasks: mask[c * words + w] has bit i (of word w) set where P[64w + i] == c.
+inline std::vector<std::uint64_t> buildBitMasks(std::string_view pattern, std::size_t words)
+{
+    std::vector<std::uint64_t> mask(ALPHABET_SIZE * words, 0);
+    for (std::size_t i = 0; i < pattern.size(); ++i)
+    {
+        unsigned char c = static_cast<unsigned char>(pattern[i]);
+        mask[c * words + i / WORD_BITS] |= std::uint64_t(1) << (i % WORD_BITS);
+    }
+    return mask;
+}
+
+/******************************************************************************
+ * Shift-Or: exact and k-mismatch (Hamming distance) search
+ ******************************************************************************/
+
+/**
+ * @brief k-mismatch Shift-Or for patterns of at most 64 characters.
+ * D[d] = ((D[d] << 1) | B[c]) & (D_old[d-1] << 1): P[0..i] matches with at
+ * most d mismatches if P[0..i-1] did and P[i] == c, or if P[0..i-1] matched
+ * with at most d-1 mismatches (P[i] is then a mismatch).
+ */
+inline std::vector<int> kMismatchMatchAll64(std::string_view text, std::string_view pattern, int k)
+{
+    int n = text.length();
+    int m = pattern.length();
+    std::vector<int> match_indices;
+    if (m == 0 || n < m || m > WORD_BITS || k < 0)
+        return match_indices;
+    k = std::min(k, m); // Every window is within m mismatches; bounds the levels below
+
+    std::uint64_t B[ALPHABET_SIZE];
+    std::vector<std::uint64_t> set = buildBitMasks(pattern, 1);
+    for (int c = 0; c < ALPHABET_SIZE; ++c)
+    {
+        B[c] = ~set[c]; // Shift-Or: 0 means "matches"
+    }
+    const std::uint64_t last = std::uint64_t(1) << (m - 1);
+    std::vector<std::uint64_t> D(k + 1, ~std::uint64_t(0));
+
+    for (int j = 0; j < n; ++j)
+    {
+        std::uint64_t b = B[static_cast<unsigned char>(text[j])];
+        std::uint64_t prev = D[0]; // D[d-1] before this character
+        D[0] = (D[0] << 1) | b;
+        for (int d = 1; d <= k; ++d)
+        {
+            std::uint64_t old = D[d];
+            D[d] = ((old << 1) | b) & (prev << 1);
+            prev = old;
+        }
+        if ((D[k] & last) == 0)
+        {
+            match_indices.push_back(j - m + 1);
+        }
+    }
+    return match_indices;
+}
+
+/**
+ * @brief k-mismatch Shift-Or for any pattern length: each D is 'words' words,
+ * shifted left by one bit with the carry moving from word w-1 into word w.
+ */
+inline std::vector<int> kMismatchMatchAllMultiword(std::string_view text, std::string_view pattern, int k)
+{
+    int n = text.length();
+    int m = pattern.length();
+    std::vector<int> match_indices;
+    if (m == 0 || n < m || k < 0)
+        return match_indices;
+    k = std::min(k, m); // Every window is within m mismatches; bounds the levels below
+
+    const std::size_t words = (m + WORD_BITS - 1) / WORD_BITS;
+    std::vector<std::uint64_t> B = buildBitMasks(pattern, words);
+    for (std::uint64_t &w : B)
+    {
+        w = ~w;
+    }
+    const std::size_t top = (m - 1) / WORD_BITS;
+    const std::uint64_t last = std::uint64_t(1) << ((m - 1) % WORD_BITS);
+    std::vector<std::uint64_t> D((k + 1) * words, ~std::uint64_t(0));
+    std::vector<std::uint64_t> prev(words), old(words);
+
+    for (int j = 0; j < n; ++j)
+    {
+        const std::uint64_t *b = &B[static_cast<unsigned char>(text[j]) * words];
+        for (int d = 0; d <= k; ++d)
+        {
+            std::uint64_t *Dd = &D[d * words];
+            std::uint64_t carry_old = 0, carry_prev = 0; // Bits shifted out of the word below
+            for (std::size_t w = 0; w < words; ++w)
+            {
+                old[w] = Dd[w];
+                std::uint64_t shifted = (old[w] << 1) | carry_old;
+                carry_old = old[w] >> (WORD_BITS - 1);
+                Dd[w] = shifted | b[w];
+                if (d > 0)
+                {
+                    Dd[w] &= (prev[w] << 1) | carry_prev;
+                    carry_prev = prev[w] >> (WORD_BITS - 1);
+                }
+            }
+            prev.swap(old); // This level before the update feeds level d + 1
+        }
+        if ((D[k * words + top] & last) == 0)
+        {
+            match_indices.push_back(j - m + 1);
+        }
+    }
+    return match_indices;
+}
+
+/**
+ * @brief Finds all windows of the text that differ from P in at most k positions.
+ * @return The starting indices of all such windows, in increasing order.
+ */
+inline std::vector<int> kMismatchMatchAll(std::string_view text, std::string_view pattern, int k)
+{
+    if (k < 0)
+        return std::vector<int>();
+    k = static_cast<int>(std::min<std::size_t>(k, pattern.size())); // Any k >= m matches every window
+    if (pattern.size() <= static_cast<std::size_t>(WORD_BITS))
+        return kMismatchMatchAll64(text, pattern, k);
+    return kMismatchMatchAllMultiword(text, pattern, k);
+}
+
+/**
+ * @brief Exact Shift-Or, in the xxxMatchAll(text, pattern) shape.
+ * @return A std::vector<int> containing the starting indices of all occurrences.
+ */
+inline std::vector<int> shiftOrMatchAll(std::string_view text, std::string_view pattern)
+{
+    return kMismatchMatchAll(text, pattern, 0);
+}
+
+/******************************************************************************
+ * Myers: edit distance (insertions, deletions, substitutions) <= k
+ ******************************************************************************/
+
+/**
+ * @brief Myers' bit-vector search for patterns of at most 64 characters.
+ * Column j of the table C[i][j] = edit distance between P[0..i] and the best
+ * substring of the text ending at j (row -1 is all zeros, so a match may start
+ * anywhere). Pv/Mv mark rows where C increases/decreases by one going down.
+ */
+inline std::vector<int> myersMatchAll64(std::string_view text, std::string_view pattern, int k)
+{
+    int n = text.length();
+    int m = pattern.length();
+    std::vector<int> match_ends;
+    if (m == 0 || m > WORD_BITS || k < 0)
+        return match_ends;
+
+    std::vector<std::uint64_t> Peq = buildBitMasks(pattern, 1);
+    const std::uint64_t last = std::uint64_t(1) << (m - 1);
+    std::uint64_t Pv = ~std::uint64_t(0), Mv = 0;
+    int score = m; // C[m-1][j]
+
+    for (int j = 0; j < n; ++j)
+    {
+        std::uint64_t Eq = Peq[static_cast<unsigned char>(text[j])];
+        std::uint64_t Xv = Eq | Mv;
+        std::uint64_t Xh = (((Eq & Pv) + Pv) ^ Pv) | Eq;
+        std::uint64_t Ph = Mv | ~(Xh | Pv);
+        std::uint64_t Mh = Pv & Xh;
+        if (Ph & last)
+            score++;
+        else if (Mh & last)
+            score--;
+        Ph <<= 1; // Row -1 never changes: nothing is shifted in
+        Mh <<= 1;
+        Pv = Mh | ~(Xv | Ph);
+        Mv = Ph & Xv;
+        if (score <= k)
+        {
+            match_ends.push_back(j);
+        }
+    }
+    return match_ends;
+}
+
+/**
+ * @brief Myers' search for any pattern length (Hyyrö's block version): each
+ * 64-row block passes its horizontal delta at the bottom row (-1, 0 or +1)
+ * to the block below as the delta entering its top row.
+ */
+inline std::vector<int> myersMatchAllMultiword(std::string_view text, std::string_view pattern, int k)
+{
+    int n = text.length();
+    int m = pattern.length();
+    std::vector<int> match_ends;
+    if (m == 0 || k < 0)
+        return match_ends;
+
+    const std::size_t words = (m + WORD_BITS - 1) / WORD_BITS;
+    std::vector<std::uint64_t> Peq = buildBitMasks(pattern, words);
+    std::vector<std::uint64_t> Pv(words, ~std::uint64_t(0)), Mv(words, 0);
+    const std::uint64_t high = std::uint64_t(1) << (WORD_BITS - 1);
+    const std::uint64_t last = std::uint64_t(1) << ((m - 1) % WORD_BITS);
+    int score = m;
+
+    for (int j = 0; j < n; ++j)
+    {
+        const std::uint64_t *eq = &Peq[static_cast<unsigned char>(text[j]) * words];
+        int h_in = 0; // Delta entering the top of this block; 0 above row 0
+        for (std::size_t w = 0; w < words; ++w)
+        {
+            std::uint64_t Eq = eq[w];
+            std::uint64_t Xv = Eq | Mv[w];
+            if (h_in < 0)
+                Eq |= 1;
+            std::uint64_t Xh = (((Eq & Pv[w]) + Pv[w]) ^ Pv[w]) | Eq;
+            std::uint64_t Ph = Mv[w] | ~(Xh | Pv[w]);
+            std::uint64_t Mh = Pv[w] & Xh;
+            std::uint64_t out_bit = (w + 1 == words) ? last : high;
+            int h_out = (Ph & out_bit) ? 1 : ((Mh & out_bit) ? -1 : 0);
+            Ph <<= 1;
+            Mh <<= 1;
+            if (h_in < 0)
+                Mh |= 1;
+            else if (h_in > 0)
+                Ph |= 1;
+            Pv[w] = Mh | ~(Xv | Ph);
+            Mv[w] = Ph & Xv;
+            h_in = h_out;
+        }
+        score += h_in; // Delta of the last row
+        if (score <= k)
+        {
+            match_ends.push_back(j);
+        }
+    }
+    return match_ends;
+}
+
+/**
+ * @brief Finds every text position where a substring with edit distance <= k to P ends.
+ * A match has no single start (e.g. one insertion more or less), so unlike the
+ * exact matchers this reports the index of the LAST character of each match.
+ * @return The end indices, in increasing order.
+ */
+inline std::vector<int> myersMatchAll(std::string_view text, std::string_view pattern, int k)
+{
+    if (pattern.size() <= static_cast<std::size_t>(WORD_BITS))
+        return myersMatchAll64(text, pattern, k);
+    return myersMatchAllMultiword(text, pattern, k);
+}
+
+#endif // APPROXMATCH_H
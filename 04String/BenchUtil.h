@@ -0,0 +1,120 @@
+#ifndef BENCHUTIL_H
+#define BENCHUTIL_H
+
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm> // For std::max
+#include <cstddef>   // For std::size_t
+#include "StringMatch.h"
+#include "ApproxMatch.h" // For shiftOrMatchAll
+
+// Shared by the testbench and the benchmarks of this directory.
+
+/******************************************************************************
+ * Single-Pattern Matchers
+ ******************************************************************************/
+
+// Every xxxMatchAll(text, pattern) matcher. The first NUM_SELECTABLE_MATCHERS
+// are the candidates of selectMatcher(); Shift-Or and matchAll itself follow.
+const char *const MATCHER_NAMES[] = {"BF", "KMP", "Horspool", "SIMD", "BM", "Sunday", "Raita", "ShiftOr", "matchAll"};
+const MatchFunction MATCHERS[] = {bruteForceMatchAll, kmpMatchAll, horspoolMatchAll, simdMatchAll, boyerMooreMatchAll,
+                                  sundayMatchAll, raitaMatchAll, shiftOrMatchAll, matchAll};
+const int NUM_MATCHERS = 9;
+const int NUM_SELECTABLE_MATCHERS = 7;
+
+/******************************************************************************
+ * Timing
+ ******************************************************************************/
+
+typedef std::chrono::steady_clock Clock;
+
+// ElapsedMs: Milliseconds since 'start'.
+inline double ElapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// NsPerByte: Best of three runs of fn, repeated so that each run covers >= 4 MB.
+inline double NsPerByte(MatchFunction fn, const std::string &text, const std::string &pattern,
+                        std::vector<int> &result)
+{
+    int reps = static_cast<int>(std::max<std::size_t>(1, (4u << 20) / text.size()));
+    double best = 0;
+    for (int run = 0; run < 3; ++run)
+    {
+        Clock::time_point start = Clock::now();
+        for (int r = 0; r < reps; ++r)
+            result = fn(text, pattern);
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / reps / text.size();
+        if (run == 0 || ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+/******************************************************************************
+ * Test Corpora for the Benchmarks
+ *
+ * Each generator returns exactly n bytes; the same rng seed gives the same text.
+ ******************************************************************************/
+
+// RandomText: Uniformly random bytes (0-255); mismatches come almost immediately.
+inline std::string RandomText(std::size_t n, std::mt19937 &rng)
+{
+    std::string text(n, '\0');
+    for (char &c : text)
+        c = static_cast<char>(rng() % 256);
+    return text;
+}
+
+// DnaText: Random over {a, c, g, t}: a low-entropy text where partial matches are common.
+inline std::string DnaText(std::size_t n, std::mt19937 &rng)
+{
+    std::string text(n, 'a');
+    for (char &c : text)
+        c = "acgt"[rng() % 4];
+    return text;
+}
+
+// EnglishLikeText: Words from a small vocabulary, skewed towards the first ones.
+inline std::string EnglishLikeText(std::size_t n, std::mt19937 &rng)
+{
+    static const char *words[] = {"the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "was", "with",
+                                  "be", "by", "on", "not", "he", "this", "are", "or", "his", "from", "at", "which",
+                                  "string", "pattern", "match", "index", "suffix", "array", "search", "text"};
+    const int num_words = sizeof(words) / sizeof(words[0]);
+    std::string text;
+    text.reserve(n + 16);
+    while (text.size() < n)
+    {
+        int k = static_cast<int>(rng() % num_words);
+        k = static_cast<int>(rng() % (k + 1)); // Skew towards the first words
+        text += words[k];
+        text += (rng() % 12 == 0) ? ". " : " ";
+    }
+    text.resize(n);
+    return text;
+}
+
+// AdversarialText: "aaaa...ab". With the pattern "aa...ab" every alignment
+// matches up to the last character: the worst case of brute force.
+inline std::string AdversarialText(std::size_t n)
+{
+    std::string text(n, 'a');
+    if (n > 0)
+        text[n - 1] = 'b';
+    return text;
+}
+
+// AdversarialPattern: "aa...ab" of length m.
+inline std::string AdversarialPattern(std::size_t m)
+{
+    std::string pattern(m, 'a');
+    if (m > 0)
+        pattern[m - 1] = 'b';
+    return pattern;
+}
+
+#endif // BENCHUTIL_H
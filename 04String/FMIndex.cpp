@@ -0,0 +1,158 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <fstream>
+#include <cstdint> // For std::uint64_t
+#include <cstdio>  // For std::remove
+#include "StringMatch.h"
+#include "TextIndex.h"
+#include "FMIndex.h"
+
+// checkAgainstKmp: Compares count/locate with kmpMatchAll for every pattern.
+bool checkAgainstKmp(const FMIndex &index, const std::string &text, const std::vector<std::string> &patterns)
+{
+    for (const std::string &p : patterns)
+    {
+        std::vector<int> expected = kmpMatchAll(text, p);
+        if (index.count(p) != expected.size() ||
+            index.locate(p) != std::vector<long long>(expected.begin(), expected.end()))
+            return false;
+    }
+    return true;
+}
+
+int main()
+{
+    std::string T = "banana";
+    FMIndex index(T, 2);
+
+    std::cout << "Target String (T): " << T << std::endl;
+    std::cout << "------------------------------------------" << std::endl;
+    std::cout << "count(\"ana\") = " << index.count("ana") << ", locate(\"ana\") = ";
+    for (long long pos : index.locate("ana"))
+    {
+        std::cout << pos << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "count(\"nab\") = " << index.count("nab") << ", count(\"banana\") = " << index.count("banana") << std::endl;
+
+    // --- Random texts and sample rates against kmpMatchAll ---
+    std::cout << "\nQueries against kmpMatchAll:" << std::endl;
+    std::mt19937 rng(2025);
+    bool same = true;
+    for (int trial = 0; trial < 300 && same; ++trial)
+    {
+        std::string text(rng() % 500, 'a');
+        int sigma = 1 + rng() % 4;
+        for (char &c : text)
+            c = static_cast<char>(trial % 7 == 0 ? rng() % 256 : 'a' + rng() % sigma); // Some with every byte, including 0
+        std::vector<std::string> patterns;
+        for (int k = 0; k < 20; ++k)
+        {
+            std::size_t len = 1 + rng() % 6;
+            if (text.size() > len && k % 4 != 0)
+                patterns.push_back(text.substr(rng() % (text.size() - len), len));
+            else
+                patterns.push_back(std::string(len, 'a' + rng() % 5));
+        }
+        same = checkAgainstKmp(FMIndex(text, 1 + rng() % 40), text, patterns);
+    }
+    std::cout << "Same results on 300 random texts: " << (same ? "Yes" : "No") << std::endl;
+
+    // Texts of 2 GiB and more are built with a 64-bit suffix array; it must sort the same way
+    bool same_sa = true;
+    for (int trial = 0; trial < 200; ++trial)
+    {
+        std::vector<int> s(rng() % 300);
+        for (int &c : s)
+            c = 1 + rng() % (1 + trial % 5);
+        s.push_back(0);
+        std::vector<std::int64_t> s64(s.begin(), s.end());
+        std::vector<int> sa = suffixArraySAIS(s, 5);
+        same_sa = same_sa && suffixArraySAIS<std::int64_t>(s64, 5) == std::vector<std::int64_t>(sa.begin(), sa.end());
+    }
+    std::cout << "64-bit SA-IS same as int: " << (same_sa ? "Yes" : "No") << std::endl;
+
+    // --- Save, then load through mmap ---
+    std::cout << "\nSave and load:" << std::endl;
+    std::string text(4 << 20, 'a');
+    for (char &c : text)
+        c = "acgt"[rng() % 4];
+    std::vector<std::string> patterns;
+    for (int k = 0; k < 200; ++k)
+        patterns.push_back(text.substr(rng() % (text.size() - 16), 4 + rng() % 12));
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    FMIndex built(text);
+    double build_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    const std::string path = "fmindex_test.bin";
+    built.save(path);
+
+    start = std::chrono::steady_clock::now();
+    FMIndex loaded = FMIndex::load(path);
+    double load_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Built in " << build_ms << " ms, loaded in " << load_ms << " ms" << std::endl;
+    std::cout << "Loaded index gives the same results: " << (checkAgainstKmp(loaded, text, patterns) ? "Yes" : "No")
+              << std::endl;
+    std::cout << "FM-index: " << static_cast<double>(loaded.memoryBytes()) / text.size() << " bytes/char, "
+              << "TextIndex: " << static_cast<double>(TextIndex(text).memoryBytes()) / text.size()
+              << " bytes/char (+1 for the text)" << std::endl;
+    std::remove(path.c_str());
+
+    // --- Index size relative to the text, by alphabet size ---
+    std::cout << "\nIndex size for 1 MB random texts:" << std::endl;
+    for (int sigma : {4, 26, 256})
+    {
+        std::string sample(1 << 20, 'a');
+        for (char &c : sample)
+            c = static_cast<char>(sigma == 256 ? rng() % 256 : 'a' + rng() % sigma);
+        double ratio = static_cast<double>(FMIndex(sample).memoryBytes()) / sample.size();
+        std::cout << "  sigma = " << sigma << ": " << ratio << " bytes/char (" << static_cast<int>(ratio * 100 + 0.5)
+                  << "% of the text)" << std::endl;
+    }
+
+    try
+    {
+        FMIndex::load("StringMatch.h"); // Not an index: throws
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+
+    // A damaged header must be rejected by load(), not crash a later query
+    FMIndex(T).save(path);
+    bool rejected = true;
+    const std::size_t zeros_offset = 8 + 7 * 8;                   // magic, 7 fields
+    const std::size_t c_offset = zeros_offset + 8 * 8 + 256 * 8;  // zeros, bottom_start
+    const std::size_t fields[] = {8, 16, 40, 56, zeros_offset, c_offset + 'a' * 8}; // length, primary, levels,
+                                                                                     // num_symbols, zeros[0], C['a']
+    for (std::size_t offset : fields)
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        std::uint64_t saved, bad = 1000000;
+        file.seekg(offset);
+        file.read(reinterpret_cast<char *>(&saved), 8);
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char *>(&bad), 8);
+        file.close();
+        try
+        {
+            FMIndex::load(path).count("ana");
+            rejected = false;
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        file.open(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char *>(&saved), 8); // Restore for the next field
+    }
+    rejected = rejected && FMIndex::load(path).count("ana") == 2; // Restored file loads again
+    std::cout << "Damaged headers rejected: " << (rejected ? "Yes" : "No") << std::endl;
+    std::remove(path.c_str());
+
+    return 0;
+}
@@ -0,0 +1,646 @@
+#ifndef FMINDEX_H
+#define FMINDEX_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>    // For std::unique_ptr
+#include <fstream>
+#include <cstddef>   // For std::size_t
+#include <cstdint>   // For std::uint64_t, std::int64_t
+#include <cstring>   // For std::memcmp, std::memcpy, std::memset
+#include <algorithm> // For std::sort, std::fill
+#include <stdexcept> // For throwing exceptions
+#include <climits>   // For INT_MAX
+#include "TextIndex.h" // For suffixArraySAIS
+#include "FileMatch.h" // For MappedFile
+
+/******************************************************************************
+ * FM-Index
+ *
+ * A compressed substitute for the suffix array of TextIndex (8 bytes/char):
+ *   - BWT: the character before each suffix, in suffix array order
+ *     (BWT[i] = T[SA[i] - 1]). The rows are the suffixes of T$, so row 0 is
+ *     the sentinel suffix "$", and the row whose suffix is T itself holds the
+ *     sentinel in the BWT ('primary').
+ *   - LF mapping: the row of suffix SA[i] - 1 is C[c] + rank_c(BWT, i) with
+ *     c = BWT[i], where C[c] counts rows starting with a smaller character.
+ *     Backward search applies it to a whole row range, one pattern character
+ *     at a time from the end: count(P) costs 2m rank queries, independent of n.
+ *   - rank_c is answered by a wavelet matrix over the BWT with the alphabet
+ *     reduced to the sigma characters that occur (code k = k-th smallest):
+ *     ceil(log2 sigma) bit vectors of n bits with rank directories, i.e.
+ *     2 levels for DNA, 5 for lowercase letters, 8 only for arbitrary bytes.
+ *   - locate: SA is kept only at text positions divisible by the sample rate,
+ *     bit-packed into ceil(log2(n / rate)) bits each; other rows walk LF
+ *     steps back until they reach a sampled one.
+ *
+ * The index can be saved to a file and loaded with mmap: the bit vectors and
+ * samples are then used in place, so loading costs no time or heap memory
+ * beyond what the queries touch. The file is in native byte order.
+ *
+ * Positions are 64-bit throughout (rank counts, SA samples, locate), so texts
+ * of many GB are supported; only the build needs the whole suffix array in
+ * memory (4 bytes per character below 2 GiB, 8 above).
+ ******************************************************************************/
+
+const int FM_SAMPLE_RATE = 32; // Default SA sampling: <= 31 LF steps per locate
+
+/**
+ * @class RankBitVector
+ * @brief A bit vector with rank support: one 64-bit count per 512 bits.
+ * Bits and counts are read through pointers, so they can live in the vectors
+ * owned here or in a memory-mapped file.
+ */
+class RankBitVector
+{
+private:
+    static const std::size_t kWordsPerBlock = 8;
+
+    std::vector<std::uint64_t> word_store;
+    std::vector<std::uint64_t> block_store;
+    const std::uint64_t *words;
+    const std::uint64_t *blocks; // blocks[b] = ones in words [0, 8b)
+    std::size_t bits;
+
+public:
+    RankBitVector() : words(nullptr), blocks(nullptr), bits(0) {}
+
+    // Constructor: n zero bits; set() them, then call buildRank().
+    explicit RankBitVector(std::size_t n) : word_store(numWords(n), 0), words(nullptr), blocks(nullptr), bits(n)
+    {
+        words = word_store.data();
+    }
+
+    // A moved vector keeps its buffer, so the pointers stay valid
+    RankBitVector(RankBitVector &&) = default;
+    RankBitVector &operator=(RankBitVector &&) = default;
+    RankBitVector(const RankBitVector &) = delete;
+    RankBitVector &operator=(const RankBitVector &) = delete;
+
+    // One spare word, so that rank1(size()) never reads past the end
+    static std::size_t numWords(std::size_t n) { return n / 64 + 1; }
+    static std::size_t numBlocks(std::size_t n) { return numWords(n) / kWordsPerBlock + 1; }
+
+    void set(std::size_t i) { word_store[i >> 6] |= std::uint64_t(1) << (i & 63); }
+
+    void buildRank()
+    {
+        std::size_t num_words = numWords(bits);
+        block_store.assign(numBlocks(bits), 0);
+        std::uint64_t ones = 0;
+        for (std::size_t w = 0; w < num_words; ++w)
+        {
+            if (w % kWordsPerBlock == 0)
+                block_store[w / kWordsPerBlock] = ones;
+            ones += __builtin_popcountll(word_store[w]);
+        }
+        blocks = block_store.data();
+    }
+
+    // attach: Uses words and counts stored elsewhere (e.g. in a mapped file).
+    void attach(std::size_t n, const std::uint64_t *w, const std::uint64_t *b)
+    {
+        word_store.clear();
+        block_store.clear();
+        bits = n;
+        words = w;
+        blocks = b;
+    }
+
+    std::size_t size() const { return bits; }
+    const std::uint64_t *wordData() const { return words; }
+    const std::uint64_t *blockData() const { return blocks; }
+
+    bool get(std::size_t i) const { return (words[i >> 6] >> (i & 63)) & 1; }
+
+    // rank1: Number of ones in [0, i).
+    std::size_t rank1(std::size_t i) const
+    {
+        std::size_t w = i >> 6;
+        std::size_t r = blocks[w / kWordsPerBlock];
+        for (std::size_t k = w - w % kWordsPerBlock; k < w; ++k)
+        {
+            r += __builtin_popcountll(words[k]);
+        }
+        if (i & 63)
+            r += __builtin_popcountll(words[w] & ((std::uint64_t(1) << (i & 63)) - 1));
+        return r;
+    }
+
+    std::size_t rank0(std::size_t i) const { return i - rank1(i); }
+};
+
+/**
+ * @class WaveletMatrix
+ * @brief rank/access over a sequence of b-bit codes with b bit vectors.
+ * Level l holds bit (b - 1 - l) of every element; between levels the elements
+ * are stably reordered so that those with a 0 bit come first (zeros[l] of
+ * them). Following a position down the levels narrows it to one code.
+ */
+class WaveletMatrix
+{
+private:
+    int levels; // b, at most 8
+    RankBitVector level[8];
+    std::size_t zeros[8];
+    std::size_t bottom_start[256]; // Where each code's run starts after the last level
+
+    friend class FMIndex; // Serialization
+
+public:
+    WaveletMatrix() : levels(0), zeros(), bottom_start() {}
+
+    // Constructor: every element of seq must be below 2^bits.
+    WaveletMatrix(std::vector<unsigned char> seq, int bits) : levels(bits), zeros(), bottom_start()
+    {
+        std::size_t n = seq.size();
+        std::vector<unsigned char> zero_part, one_part;
+        for (int l = 0; l < levels; ++l)
+        {
+            int bit = levels - 1 - l;
+            level[l] = RankBitVector(n);
+            zero_part.clear();
+            one_part.clear();
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if ((seq[i] >> bit) & 1)
+                {
+                    level[l].set(i);
+                    one_part.push_back(seq[i]);
+                }
+                else
+                {
+                    zero_part.push_back(seq[i]);
+                }
+            }
+            level[l].buildRank();
+            zeros[l] = zero_part.size();
+            seq.assign(zero_part.begin(), zero_part.end());
+            seq.insert(seq.end(), one_part.begin(), one_part.end());
+        }
+        for (int c = 0; c < (1 << levels); ++c)
+        {
+            bottom_start[c] = descend(static_cast<unsigned char>(c), 0);
+        }
+    }
+
+    // descend: Position of index i after following code c through all levels.
+    std::size_t descend(unsigned char c, std::size_t i) const
+    {
+        for (int l = 0; l < levels; ++l)
+        {
+            if ((c >> (levels - 1 - l)) & 1)
+                i = zeros[l] + level[l].rank1(i);
+            else
+                i = level[l].rank0(i);
+        }
+        return i;
+    }
+
+    // rank: Occurrences of c in [0, i).
+    std::size_t rank(unsigned char c, std::size_t i) const { return descend(c, i) - bottom_start[c]; }
+
+    // accessRank: Returns seq[i] and stores rank(seq[i], i) in 'r', in one pass.
+    unsigned char accessRank(std::size_t i, std::size_t &r) const
+    {
+        unsigned c = 0;
+        for (int l = 0; l < levels; ++l)
+        {
+            bool b = level[l].get(i);
+            c = (c << 1) | b;
+            i = b ? zeros[l] + level[l].rank1(i) : level[l].rank0(i);
+        }
+        r = i - bottom_start[c];
+        return static_cast<unsigned char>(c);
+    }
+};
+
+/**
+ * @class FMIndex
+ * @brief Substring count/locate over a text that is not kept in memory.
+ */
+class FMIndex
+{
+private:
+    struct Header
+    {
+        char magic[8];
+        std::uint64_t length;      // Text length n (rows = n + 1)
+        std::uint64_t primary;     // Row whose BWT character is the sentinel
+        std::uint64_t sample_rate;
+        std::uint64_t num_samples;
+        std::uint64_t levels;       // Wavelet levels: codeBits(num_symbols)
+        std::uint64_t sample_width; // Bits per packed sample
+        std::uint64_t num_symbols;  // Distinct characters of the text
+        std::uint64_t zeros[8];
+        std::uint64_t bottom_start[256];
+        std::uint64_t C[256];
+        unsigned char symbols[256]; // Code -> character
+    };
+
+    std::size_t length;
+    std::size_t primary;
+    std::size_t sample_rate;
+    std::size_t C[256]; // Rows whose suffix starts with a character < c (row 0 is "$")
+    int num_symbols;
+    unsigned char symbols[256]; // Code k -> the k-th smallest character of the text
+    int code[256];              // Character -> code, -1 if it does not occur
+    WaveletMatrix bwt;          // BWT as codes; the sentinel is stored as code 0 at row 'primary'
+    RankBitVector sampled;      // Rows whose SA value is stored
+    int sample_width;
+    std::vector<std::uint64_t> sample_store;
+    const std::uint64_t *samples; // SA / sample_rate of the sampled rows, in row order, sample_width bits each
+    std::unique_ptr<MappedFile> mapping; // Set when loaded from a file
+
+    FMIndex()
+        : length(0), primary(0), sample_rate(FM_SAMPLE_RATE), C(), num_symbols(0), symbols(), code(),
+          sample_width(1), samples(nullptr)
+    {
+    }
+
+    // codeBits: Wavelet levels for 'symbols' distinct codes (at least 1).
+    static int codeBits(std::size_t symbols)
+    {
+        int bits = 1;
+        while ((std::size_t(1) << bits) < symbols)
+            bits++;
+        return bits;
+    }
+
+    // numSampleWords: 64-bit words holding 'num_samples' packed values of 'width' bits.
+    static std::size_t numSampleWords(std::size_t num_samples, int width) { return (num_samples * width + 63) / 64; }
+
+    void setCodes()
+    {
+        std::fill(code, code + 256, -1);
+        for (int k = 0; k < num_symbols; ++k)
+            code[symbols[k]] = k;
+    }
+
+    // occ: rank_c(BWT, i), not counting the sentinel stored as code 0.
+    std::size_t occ(unsigned char c, std::size_t i) const
+    {
+        int k = code[c];
+        if (k < 0)
+            return 0;
+        std::size_t r = bwt.rank(static_cast<unsigned char>(k), i);
+        return (k == 0 && i > primary) ? r - 1 : r;
+    }
+
+    // sampleAt: The k-th packed sample.
+    std::size_t sampleAt(std::size_t k) const
+    {
+        std::size_t bit = k * sample_width;
+        std::size_t w = bit >> 6, shift = bit & 63;
+        std::uint64_t v = samples[w] >> shift;
+        if (shift + sample_width > 64)
+            v |= samples[w + 1] << (64 - shift);
+        return sample_width == 64 ? v : v & ((std::uint64_t(1) << sample_width) - 1);
+    }
+
+    // textPosition: SA[row], by LF steps back to a sampled row.
+    std::size_t textPosition(std::size_t row) const
+    {
+        std::size_t steps = 0;
+        while (!sampled.get(row)) // Row 'primary' (position 0) is always sampled
+        {
+            std::size_t r;
+            unsigned char k = bwt.accessRank(row, r);
+            row = C[symbols[k]] + r - ((k == 0 && row > primary) ? 1 : 0);
+            steps++;
+        }
+        return sampleAt(sampled.rank1(row)) * sample_rate + steps;
+    }
+
+    // range: Backward search; the rows [first, last) whose suffix starts with P.
+    std::pair<std::size_t, std::size_t> range(std::string_view pattern) const
+    {
+        std::size_t first = 0, last = length + 1;
+        for (std::size_t k = pattern.size(); k-- > 0 && first < last;)
+        {
+            unsigned char c = static_cast<unsigned char>(pattern[k]);
+            first = C[c] + occ(c, first);
+            last = C[c] + occ(c, last);
+        }
+        return first < last ? std::make_pair(first, last) : std::make_pair(first, first);
+    }
+
+    // padded: 'bytes' rounded up to a multiple of 8, as every array is stored.
+    static std::size_t padded(std::size_t bytes) { return (bytes + 7) / 8 * 8; }
+
+    // fileBytes: Size of the saved index with 'levels' wavelet levels and 'sample_words' words of samples.
+    static std::size_t fileBytes(std::size_t rows, std::size_t levels, std::size_t sample_words)
+    {
+        std::size_t per_vector = padded(RankBitVector::numWords(rows) * sizeof(std::uint64_t)) +
+                                 padded(RankBitVector::numBlocks(rows) * sizeof(std::uint64_t));
+        return padded(sizeof(Header)) + (levels + 1) * per_vector + sample_words * sizeof(std::uint64_t);
+    }
+
+    // corrupt: The error thrown by load() for a header that does not fit the file.
+    static std::runtime_error corrupt(const std::string &path, const std::string &what)
+    {
+        return std::runtime_error("Error: FM-index file " + path + " is corrupt (" + what + ").");
+    }
+
+    static void writePadded(std::ofstream &out, const void *data, std::size_t bytes)
+    {
+        static const char zeros[8] = {0};
+        out.write(static_cast<const char *>(data), bytes);
+        out.write(zeros, (8 - bytes % 8) % 8); // Keep every array 8-byte aligned
+    }
+
+    // take: Next 'bytes' (rounded up to 8) of a mapped file, with bounds checking.
+    static const char *take(const char *&cursor, const char *end, std::size_t bytes)
+    {
+        if (static_cast<std::size_t>(end - cursor) < padded(bytes))
+        {
+            throw std::runtime_error("Error: FM-index file is truncated.");
+        }
+        const char *p = cursor;
+        cursor += padded(bytes);
+        return p;
+    }
+
+    static void attachBits(RankBitVector &bits, std::size_t n, const char *&cursor, const char *end)
+    {
+        const std::uint64_t *w = reinterpret_cast<const std::uint64_t *>(
+            take(cursor, end, RankBitVector::numWords(n) * sizeof(std::uint64_t)));
+        const std::uint64_t *b = reinterpret_cast<const std::uint64_t *>(
+            take(cursor, end, RankBitVector::numBlocks(n) * sizeof(std::uint64_t)));
+        bits.attach(n, w, b);
+    }
+
+    // build: SA of T$ with Index positions, then the BWT, C and the SA samples.
+    template <typename Index>
+    void build(std::string_view text)
+    {
+        std::size_t rows = length + 1;
+
+        // SA of T$: bytes are shifted to 1..256 so that the sentinel 0 is smallest
+        std::vector<Index> s(rows);
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            s[i] = static_cast<unsigned char>(text[i]) + 1;
+        }
+        s[length] = 0;
+        std::vector<Index> sa = suffixArraySAIS<Index>(s, 256);
+        s = std::vector<Index>(); // Free before the next allocations
+
+        // Alphabet: only the characters that occur get a code
+        std::size_t counts[256] = {0};
+        for (char ch : text)
+            counts[static_cast<unsigned char>(ch)]++;
+        for (int c = 0; c < 256; ++c)
+        {
+            if (counts[c] > 0)
+                symbols[num_symbols++] = static_cast<unsigned char>(c);
+        }
+        setCodes();
+
+        std::vector<unsigned char> last_column(rows);
+        std::vector<std::uint64_t> values;
+        sampled = RankBitVector(rows);
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            std::size_t p = sa[row];
+            if (p == 0)
+            {
+                primary = row;
+                last_column[row] = 0;
+            }
+            else
+            {
+                last_column[row] = static_cast<unsigned char>(code[static_cast<unsigned char>(text[p - 1])]);
+            }
+            if (p % sample_rate == 0)
+            {
+                sampled.set(row);
+                values.push_back(p / sample_rate);
+            }
+        }
+        sampled.buildRank();
+        sa = std::vector<Index>();
+
+        // Pack the samples into just enough bits for the largest one
+        sample_width = 1;
+        while (sample_width < 64 && ((length / sample_rate) >> sample_width) != 0)
+            sample_width++;
+        sample_store.assign(numSampleWords(values.size(), sample_width), 0);
+        for (std::size_t k = 0; k < values.size(); ++k)
+        {
+            std::size_t bit = k * sample_width;
+            sample_store[bit >> 6] |= values[k] << (bit & 63);
+            if ((bit & 63) + sample_width > 64)
+                sample_store[(bit >> 6) + 1] |= values[k] >> (64 - (bit & 63));
+        }
+        samples = sample_store.data();
+
+        std::size_t below = 1; // Row 0 is the sentinel suffix
+        for (int c = 0; c < 256; ++c)
+        {
+            C[c] = below;
+            below += counts[c];
+        }
+        bwt = WaveletMatrix(std::move(last_column), codeBits(num_symbols));
+    }
+
+public:
+    /**
+     * @brief Builds the index of 'text' (the text itself is not kept).
+     * @param sample_rate Every sample_rate-th text position keeps its SA value.
+     */
+    explicit FMIndex(std::string_view text, int sample_rate_ = FM_SAMPLE_RATE) : FMIndex()
+    {
+        if (sample_rate_ < 1)
+        {
+            throw std::invalid_argument("Error: FMIndex sample rate must be positive.");
+        }
+        length = text.size();
+        sample_rate = sample_rate_;
+        if (text.size() < static_cast<std::size_t>(INT_MAX))
+            build<int>(text);
+        else
+            build<std::int64_t>(text); // 2 GiB and more: 64-bit suffix array
+    }
+
+    FMIndex(FMIndex &&) = default;
+    FMIndex &operator=(FMIndex &&) = default;
+
+    // save: Writes the index to 'path'; throws std::runtime_error on failure.
+    void save(const std::string &path) const
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            throw std::runtime_error("Error: Cannot write FM-index file " + path);
+        }
+        Header h;
+        std::memset(&h, 0, sizeof(h));
+        std::memcpy(h.magic, "FMINDEX1", 8);
+        h.length = length;
+        h.primary = primary;
+        h.sample_rate = sample_rate;
+        h.num_samples = sampled.rank1(length + 1);
+        h.levels = bwt.levels;
+        h.sample_width = sample_width;
+        h.num_symbols = num_symbols;
+        for (int l = 0; l < bwt.levels; ++l)
+            h.zeros[l] = bwt.zeros[l];
+        for (int c = 0; c < 256; ++c)
+        {
+            h.bottom_start[c] = bwt.bottom_start[c];
+            h.C[c] = C[c];
+            h.symbols[c] = symbols[c];
+        }
+        writePadded(out, &h, sizeof(h));
+
+        std::size_t rows = length + 1;
+        for (int l = 0; l <= bwt.levels; ++l)
+        {
+            const RankBitVector &v = l < bwt.levels ? bwt.level[l] : sampled;
+            writePadded(out, v.wordData(), RankBitVector::numWords(rows) * sizeof(std::uint64_t));
+            writePadded(out, v.blockData(), RankBitVector::numBlocks(rows) * sizeof(std::uint64_t));
+        }
+        writePadded(out, samples, numSampleWords(h.num_samples, sample_width) * sizeof(std::uint64_t));
+        if (!out)
+        {
+            throw std::runtime_error("Error: Failed writing FM-index file " + path);
+        }
+    }
+
+    /**
+     * @brief Maps an index written by save(); its arrays are used in place.
+     * Every header field is checked against the file size and against the
+     * attached bit vectors (O(1) rank queries), and std::runtime_error is
+     * thrown if anything is out of range, so a damaged header cannot make the
+     * queries read outside the mapping. The bit vector payload itself is not
+     * rescanned, which would make loading O(n).
+     */
+    static FMIndex load(const std::string &path)
+    {
+        FMIndex index;
+        index.mapping.reset(new MappedFile(path));
+        std::string_view file = index.mapping->view();
+        const char *cursor = file.data();
+        const char *end = file.data() + file.size();
+
+        const Header *h = reinterpret_cast<const Header *>(take(cursor, end, sizeof(Header)));
+        if (std::memcmp(h->magic, "FMINDEX1", 8) != 0)
+        {
+            throw std::runtime_error("Error: " + path + " is not an FM-index file.");
+        }
+        if (h->length > file.size() * 4) // Every row takes at least 2 bits of the file
+            throw corrupt(path, "text length");
+        if (h->primary > h->length)
+            throw corrupt(path, "primary row");
+        if (h->sample_rate < 1 || h->num_samples > h->length + 1 || h->sample_width < 1 || h->sample_width > 64)
+            throw corrupt(path, "sampling");
+        if (h->num_symbols > 256 || h->levels != static_cast<std::uint64_t>(codeBits(h->num_symbols)))
+            throw corrupt(path, "alphabet");
+        for (std::uint64_t k = 1; k < h->num_symbols; ++k)
+        {
+            if (h->symbols[k - 1] >= h->symbols[k])
+                throw corrupt(path, "alphabet");
+        }
+        for (std::uint64_t l = 0; l < h->levels; ++l)
+        {
+            if (h->zeros[l] > h->length + 1)
+                throw corrupt(path, "wavelet level sizes");
+        }
+        for (int c = 0; c < 256; ++c)
+        {
+            if (h->bottom_start[c] > h->length + 1 || h->C[c] > h->length + 1)
+                throw corrupt(path, "character counts");
+        }
+        int width = static_cast<int>(h->sample_width);
+        if (file.size() != fileBytes(h->length + 1, h->levels, numSampleWords(h->num_samples, width)))
+            throw corrupt(path, "file size does not match the header");
+
+        index.length = h->length;
+        index.primary = h->primary;
+        index.sample_rate = h->sample_rate;
+        index.sample_width = width;
+        index.num_symbols = static_cast<int>(h->num_symbols);
+        index.bwt.levels = static_cast<int>(h->levels);
+        for (int l = 0; l < index.bwt.levels; ++l)
+            index.bwt.zeros[l] = h->zeros[l];
+        for (int c = 0; c < 256; ++c)
+        {
+            index.bwt.bottom_start[c] = h->bottom_start[c];
+            index.C[c] = h->C[c];
+            index.symbols[c] = h->symbols[c];
+        }
+        index.setCodes();
+
+        std::size_t rows = index.length + 1;
+        for (int l = 0; l < index.bwt.levels; ++l)
+            attachBits(index.bwt.level[l], rows, cursor, end);
+        attachBits(index.sampled, rows, cursor, end);
+        index.samples = reinterpret_cast<const std::uint64_t *>(
+            take(cursor, end, numSampleWords(h->num_samples, width) * sizeof(std::uint64_t)));
+
+        // The header must also agree with the bit vectors: then every rank
+        // query of range() and textPosition() stays within [0, rows]
+        if (h->num_samples != index.sampled.rank1(rows) || !index.sampled.get(index.primary))
+            throw corrupt(path, "sample count");
+        for (int l = 0; l < index.bwt.levels; ++l)
+        {
+            if (index.bwt.zeros[l] != index.bwt.level[l].rank0(rows))
+                throw corrupt(path, "wavelet level sizes");
+        }
+        for (int k = 0; k < (1 << index.bwt.levels); ++k)
+        {
+            if (index.bwt.bottom_start[k] != index.bwt.descend(static_cast<unsigned char>(k), 0))
+                throw corrupt(path, "wavelet level sizes");
+        }
+        // C must be the prefix sums of the character counts; as all codes
+        // together count 'rows' elements, unused codes then occur nowhere
+        std::size_t below = 1; // Row 0 is the sentinel suffix
+        for (int c = 0; c < 256; ++c)
+        {
+            if (index.C[c] != below)
+                throw corrupt(path, "character counts");
+            below += index.occ(static_cast<unsigned char>(c), rows);
+        }
+        if (below != rows)
+            throw corrupt(path, "character counts");
+        return index;
+    }
+
+    std::size_t size() const { return length; }
+
+    // Bytes of the index structures (as saved; the text is not stored)
+    std::size_t memoryBytes() const
+    {
+        std::size_t num_samples = sampled.rank1(length + 1);
+        return fileBytes(length + 1, bwt.levels, numSampleWords(num_samples, sample_width));
+    }
+
+    // count: Number of occurrences of P, with 2m rank queries.
+    std::size_t count(std::string_view pattern) const
+    {
+        if (pattern.empty())
+            return 0;
+        std::pair<std::size_t, std::size_t> r = range(pattern);
+        return r.second - r.first;
+    }
+
+    // locate: Starting indices of all occurrences, in increasing order (like parallelMatchAll).
+    std::vector<long long> locate(std::string_view pattern) const
+    {
+        std::vector<long long> match_indices;
+        if (pattern.empty())
+            return match_indices;
+        std::pair<std::size_t, std::size_t> r = range(pattern);
+        match_indices.reserve(r.second - r.first);
+        for (std::size_t row = r.first; row < r.second; ++row)
+        {
+            match_indices.push_back(static_cast<long long>(textPosition(row)));
+        }
+        std::sort(match_indices.begin(), match_indices.end());
+        return match_indices;
+    }
+};
+
+#endif // FMINDEX_H
@@ -0,0 +1,202 @@
+#ifndef FILEMATCH_H
+#define FILEMATCH_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cstddef>   // For std::size_t
+#include <stdexcept> // For throwing exceptions
+#include <algorithm> // For std::min
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>    // open
+#include <sys/mman.h> // mmap, munmap, madvise
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // close
+#define FILEMATCH_HAS_MMAP 1
+#else
+#include <fstream>
+#define FILEMATCH_HAS_MMAP 0
+#endif
+
+/******************************************************************************
+ * Memory-Mapped File
+ ******************************************************************************/
+
+/**
+ * @class MappedFile
+ * @brief Maps a whole file read-only into memory and exposes it as a string_view.
+ * The pages are loaded lazily by the OS, so opening a multi-GB file is instant
+ * and nothing is copied to the heap. Where mmap is not available, the file is
+ * read into a buffer instead.
+ */
+class MappedFile
+{
+private:
+    const char *data;
+    std::size_t length;
+#if !FILEMATCH_HAS_MMAP
+    std::string buffer;
+#endif
+
+public:
+    // Constructor: throws std::runtime_error if the file cannot be opened or mapped.
+    explicit MappedFile(const std::string &path) : data(nullptr), length(0)
+    {
+#if FILEMATCH_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Error: Cannot open file " + path);
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Error: Cannot stat file " + path);
+        }
+        length = static_cast<std::size_t>(st.st_size);
+        if (length > 0) // mmap rejects empty mappings
+        {
+            void *p = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("Error: Cannot map file " + path);
+            }
+            ::madvise(p, length, MADV_SEQUENTIAL); // A hint only; failure is harmless
+            data = static_cast<const char *>(p);
+        }
+        ::close(fd); // The mapping stays valid after close
+#else
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+        {
+            throw std::runtime_error("Error: Cannot open file " + path);
+        }
+        buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        data = buffer.data();
+        length = buffer.size();
+#endif
+    }
+
+    ~MappedFile()
+    {
+#if FILEMATCH_HAS_MMAP
+        if (data != nullptr)
+        {
+            ::munmap(const_cast<char *>(data), length);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    std::size_t size() const { return length; }
+    std::string_view view() const { return std::string_view(data, length); }
+};
+
+/******************************************************************************
+ * Parallel Chunked Matching
+ ******************************************************************************/
+
+const std::size_t MATCH_CHUNK_BYTES = 16u << 20; // Default bytes owned by one chunk
+
+/**
+ * @brief Runs a single-pattern matcher over 'text' in parallel chunks.
+ *
+ * Chunk k owns the match start positions [k * chunk, (k + 1) * chunk) and is
+ * searched over that range plus the next m - 1 bytes, so a match crossing the
+ * chunk border is still seen in full. Matches starting in that overlap belong
+ * to the next chunk and are dropped, so each occurrence is reported exactly
+ * once. Chunks are claimed by the workers from a shared counter, and the
+ * per-chunk results are concatenated in chunk order, so the output is sorted.
+ *
+ * @param text The text to search, e.g. MappedFile::view().
+ * @param pattern The pattern to search for.
+ * @param matcher Any matcher with the xxxMatchAll(text, pattern) shape: a
+ * function, a lambda, or an object such as a prebuilt StaticMatcher wrapped in
+ * a lambda. Names with instrumented overloads (kmpMatchAll, ...) must pick the
+ * two-argument one, e.g. static_cast<MatchFunction>(kmpMatchAll).
+ * @param threads Number of worker threads (0 = hardware concurrency).
+ * @param chunk_bytes Positions owned by one chunk; must fit in an int with the overlap.
+ * @return The starting offsets of all occurrences, in increasing order.
+ */
+template <typename Matcher>
+std::vector<long long> parallelMatchAll(std::string_view text, std::string_view pattern, Matcher matcher,
+                                        unsigned threads = 0, std::size_t chunk_bytes = MATCH_CHUNK_BYTES)
+{
+    std::vector<long long> match_indices;
+    std::size_t n = text.size();
+    std::size_t m = pattern.size();
+    if (m == 0 || n < m)
+        return match_indices;
+    if (chunk_bytes == 0)
+        chunk_bytes = MATCH_CHUNK_BYTES;
+
+    std::size_t num_chunks = (n - m) / chunk_bytes + 1; // Enough chunks to own every start in [0, n - m]
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::min<std::size_t>(threads, num_chunks));
+
+    std::vector<std::vector<int>> chunk_matches(num_chunks);
+    std::atomic<std::size_t> next_chunk(0);
+    auto worker = [&]() {
+        std::size_t k;
+        while ((k = next_chunk.fetch_add(1, std::memory_order_relaxed)) < num_chunks)
+        {
+            std::size_t start = k * chunk_bytes;
+            std::size_t len = std::min(chunk_bytes + m - 1, n - start);
+            std::vector<int> found = matcher(text.substr(start, len), pattern);
+            while (!found.empty() && static_cast<std::size_t>(found.back()) >= chunk_bytes)
+            {
+                found.pop_back(); // Starts in the overlap: owned by the next chunk
+            }
+            chunk_matches[k] = std::move(found);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t)
+    {
+        pool.emplace_back(worker);
+    }
+    worker(); // The calling thread works too
+    for (std::thread &th : pool)
+    {
+        th.join();
+    }
+
+    std::size_t total = 0;
+    for (const std::vector<int> &found : chunk_matches)
+    {
+        total += found.size();
+    }
+    match_indices.reserve(total);
+    for (std::size_t k = 0; k < num_chunks; ++k)
+    {
+        long long base = static_cast<long long>(k * chunk_bytes);
+        for (int pos : chunk_matches[k])
+        {
+            match_indices.push_back(base + pos);
+        }
+    }
+    return match_indices;
+}
+
+/**
+ * @brief Maps the file at 'path' and searches it with parallelMatchAll.
+ * @return The starting offsets of all occurrences in the file, in increasing order.
+ */
+template <typename Matcher>
+std::vector<long long> matchFile(const std::string &path, std::string_view pattern, Matcher matcher,
+                                 unsigned threads = 0, std::size_t chunk_bytes = MATCH_CHUNK_BYTES)
+{
+    MappedFile file(path);
+    return parallelMatchAll(file.view(), pattern, matcher, threads, chunk_bytes);
+}
+
+#endif // FILEMATCH_H
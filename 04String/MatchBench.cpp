@@ -0,0 +1,110 @@
+#include <iostream>
+#include <iomanip> // For std::setw
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdlib> // For std::atoi
+#include "StringMatch.h"
+#include "BenchUtil.h"
+
+/**
+ * Benchmark: every single-pattern matcher on generated corpora.
+ *   - Corpora (BenchUtil.h): random bytes, DNA-like, English-like, and
+ *     adversarial "aaaa...ab" searched for "aa...ab".
+ *   - Text sizes from 1 KB up to the size given on the command line (default
+ *     32 MB; 1024 gives the full 1 GB range), in steps of 32x.
+ *   - Pattern lengths 1 to 1024, taken from the middle of the text (except
+ *     for the adversarial corpus).
+ * For each case it prints ns/byte per matcher (best of three, repeated so
+ * that each run covers >= 4 MB) and the character comparisons per byte of
+ * the instrumented BF/KMP/Horspool. Every result is compared with KMP.
+ * Brute force is skipped ("-") where it would need more than 2^32 comparisons.
+ *
+ * Usage: MatchBench [largest text in MB, default 32]
+ */
+
+const long long BF_COMPARISON_LIMIT = 1LL << 32;
+
+std::string SizeName(std::size_t bytes)
+{
+    if (bytes >= (1u << 30))
+        return std::to_string(bytes >> 30) + " GB";
+    if (bytes >= (1u << 20))
+        return std::to_string(bytes >> 20) + " MB";
+    return std::to_string(bytes >> 10) + " KB";
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t max_bytes = (argc >= 2 ? static_cast<std::size_t>(std::atoi(argv[1])) : 32) << 20;
+    if (max_bytes == 0 || max_bytes > (std::size_t(1) << 30))
+    {
+        std::cerr << "Largest text must be between 1 and 1024 MB." << std::endl;
+        return 1;
+    }
+    const char *corpora[] = {"random", "DNA-like", "English-like", "adversarial"};
+    const int pattern_sizes[] = {1, 4, 16, 64, 256, 1024};
+
+    std::cout << "--- String Matching Benchmark (ns/byte; cmp/B = comparisons per byte) ---" << std::endl;
+    std::mt19937 rng(2025);
+    bool all_same = true;
+
+    for (int corpus = 0; corpus < 4; ++corpus)
+    {
+        for (std::size_t n = 1024; n <= max_bytes; n *= 32)
+        {
+            std::string text = corpus == 0   ? RandomText(n, rng)
+                               : corpus == 1 ? DnaText(n, rng)
+                               : corpus == 2 ? EnglishLikeText(n, rng)
+                                             : AdversarialText(n);
+
+            std::cout << "\n" << corpora[corpus] << ", " << SizeName(n) << std::endl;
+            std::cout << std::setw(6) << "m";
+            for (const char *name : MATCHER_NAMES)
+                std::cout << std::setw(9) << name;
+            std::cout << std::setw(10) << "cmp/B BF" << std::setw(8) << "KMP" << std::setw(10) << "Horspool" << std::endl;
+
+            for (int m : pattern_sizes)
+            {
+                if (static_cast<std::size_t>(m) > n)
+                    continue;
+                std::string pattern = corpus == 3 ? AdversarialPattern(m) : text.substr((n - m) / 2, m);
+                std::vector<int> expected = kmpMatchAll(text, pattern), got;
+                bool skip_bf = static_cast<long long>(n) * m > BF_COMPARISON_LIMIT;
+
+                std::cout << std::setw(6) << m << std::fixed << std::setprecision(3);
+                for (int k = 0; k < NUM_MATCHERS; ++k)
+                {
+                    if (k == 0 && skip_bf)
+                    {
+                        std::cout << std::setw(9) << "-";
+                        continue;
+                    }
+                    std::cout << std::setw(9) << NsPerByte(MATCHERS[k], text, pattern, got) << std::flush;
+                    if (got != expected)
+                    {
+                        std::cout << "\nMismatch: " << MATCHER_NAMES[k] << " disagrees with KMP!" << std::endl;
+                        all_same = false;
+                    }
+                }
+
+                MatchStats bf, kmp, horspool;
+                if (!skip_bf)
+                    bruteForceMatchAll(text, pattern, bf);
+                kmpMatchAll(text, pattern, kmp);
+                horspoolMatchAll(text, pattern, horspool);
+                std::cout << std::setprecision(2) << std::setw(10);
+                if (skip_bf)
+                    std::cout << "-";
+                else
+                    std::cout << static_cast<double>(bf.comparisons) / n;
+                std::cout << std::setw(8) << static_cast<double>(kmp.comparisons) / n << std::setw(10)
+                          << static_cast<double>(horspool.comparisons) / n << std::endl;
+            }
+        }
+    }
+
+    std::cout << "\nAll matchers agree: " << (all_same ? "Yes" : "No") << std::endl;
+    std::cout << "\n--- Benchmark Complete ---" << std::endl;
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <iostream>
+#include <iomanip> // For std::setw
+#include <string>
+#include <vector>
+#include <random>
+#include "StringMatch.h"
+#include "BenchUtil.h"
+
+/**
+ * Benchmark: calibrates the thresholds used by matchAll().
+ * Times every matcher on random texts over alphabets of 2, 4, 26 and 256
+ * characters, for several text and pattern lengths, and prints the ns/byte
+ * of the fastest matcher next to the one matchAll() picks. The patterns are
+ * taken from the middle of the text, so there is at least one match. Each
+ * time is the best of three runs; all results are compared with brute force.
+ *
+ * Re-run after changing a matcher and adjust MATCH_THRESHOLDS_AVX2 or
+ * MATCH_THRESHOLDS_SCALAR in StringMatch.h (whichever this CPU uses) if the
+ * picks fall behind.
+ */
+
+int main()
+{
+    std::cout << "--- matchAll Calibration (ns/byte) ---" << std::endl;
+    std::mt19937 rng(2025);
+    const int alphabets[] = {2, 4, 26, 256};
+    const int text_sizes[] = {64, 1024, 16 << 20};
+    const int pattern_sizes[] = {1, 2, 4, 8, 16, 32, 64, 256};
+
+    for (int n : text_sizes)
+    {
+        std::cout << "\nText length " << n << std::endl;
+        std::cout << std::setw(6) << "sigma" << std::setw(6) << "m" << std::setw(10) << "fastest" << std::setw(10)
+                  << "ns/byte" << std::setw(10) << "picked" << std::setw(10) << "ns/byte" << std::endl;
+        for (int sigma : alphabets)
+        {
+            std::string text(n, 'a');
+            for (char &c : text)
+                c = static_cast<char>(sigma == 256 ? rng() % 256 : 'a' + rng() % sigma);
+            for (int m : pattern_sizes)
+            {
+                if (m > n)
+                    continue;
+                std::string pattern = text.substr((n - m) / 2, m);
+                std::vector<int> expected = bruteForceMatchAll(text, pattern), got;
+                int fastest = 0;
+                double best = 0;
+                for (int k = 0; k < NUM_SELECTABLE_MATCHERS; ++k)
+                {
+                    double ns = NsPerByte(MATCHERS[k], text, pattern, got);
+                    if (got != expected)
+                        std::cout << "Mismatch: " << MATCHER_NAMES[k] << " disagrees with brute force!" << std::endl;
+                    if (k == 0 || ns < best)
+                    {
+                        best = ns;
+                        fastest = k;
+                    }
+                }
+                MatchFunction pick = selectMatcher(text, pattern);
+                const char *picked = "?";
+                for (int k = 0; k < NUM_SELECTABLE_MATCHERS; ++k)
+                {
+                    if (MATCHERS[k] == pick)
+                        picked = MATCHER_NAMES[k];
+                }
+                double picked_ns = NsPerByte(matchAll, text, pattern, got);
+                std::cout << std::setw(6) << sigma << std::setw(6) << m << std::setw(10) << MATCHER_NAMES[fastest]
+                          << std::fixed << std::setprecision(3) << std::setw(10) << best << std::setw(10) << picked
+                          << std::setw(10) << picked_ns << std::endl;
+            }
+        }
+    }
+
+    std::cout << "\n--- Benchmark Complete ---" << std::endl;
+    return 0;
+}
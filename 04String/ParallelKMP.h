@@ -0,0 +1,110 @@
+#ifndef PARALLELKMP_H
+#define PARALLELKMP_H
+
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <cstddef>   // For std::size_t
+#include <algorithm> // For std::max, std::min
+#include "StringMatch.h"
+
+/******************************************************************************
+ * Parallel Chunked KMP
+ *
+ * The KMP state after reading text[0..i] is the length j of the longest
+ * prefix of P that ends at i. Since j <= m - 1 after a match has been taken
+ * back through Next, that state depends only on the last m - 1 bytes. So a
+ * thread can start in state 0 m - 1 bytes before its chunk and reach exactly
+ * the state a sequential scan would have at the chunk start: the chunks are
+ * stitched together by re-scanning m - 1 bytes instead of passing states
+ * from thread to thread.
+ *
+ * Each thread owns the matches that END inside its chunk, so every match is
+ * reported once, and the per-thread lists are concatenated in order.
+ ******************************************************************************/
+
+/**
+ * @brief Runs the KMP automaton over text[warmup, hi) in state 0 at 'warmup'
+ * and appends the start of every match ending at a position >= lo.
+ */
+inline void kmpScanRange(std::string_view text, std::string_view pattern, const std::vector<int> &next,
+                         std::size_t warmup, std::size_t lo, std::size_t hi, std::vector<long long> &out)
+{
+    std::size_t m = pattern.size();
+    std::size_t j = 0;
+    for (std::size_t i = warmup; i < hi; ++i)
+    {
+        while (j > 0 && text[i] != pattern[j])
+        {
+            j = next[j - 1];
+        }
+        if (text[i] == pattern[j])
+        {
+            j++;
+        }
+        if (j == m)
+        {
+            if (i >= lo)
+            {
+                out.push_back(static_cast<long long>(i + 1 - m));
+            }
+            j = next[j - 1];
+        }
+    }
+}
+
+/**
+ * @brief Finds all occurrences of a pattern with one KMP scan per thread.
+ *
+ * @param text The string to be searched in; may be larger than 2 GB.
+ * @param pattern The string to search for.
+ * @param threads Number of threads (0 = hardware concurrency).
+ * @return The starting indices of all occurrences, in increasing order.
+ */
+inline std::vector<long long> kmpParallelMatchAll(std::string_view text, std::string_view pattern, unsigned threads = 0)
+{
+    std::vector<long long> match_indices;
+    std::size_t n = text.size();
+    std::size_t m = pattern.size();
+    if (m == 0 || n < m)
+        return match_indices;
+
+    std::vector<int> next = computeNextTable(pattern); // Shared, read-only
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    // A chunk shorter than the overlap would mostly re-scan its neighbour
+    threads = static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(threads, n / (4 * m))));
+
+    std::vector<std::vector<long long>> found(threads);
+    auto scan = [&](unsigned t) {
+        std::size_t lo = n / threads * t;
+        std::size_t hi = (t + 1 == threads) ? n : n / threads * (t + 1);
+        std::size_t warmup = lo >= m - 1 ? lo - (m - 1) : 0;
+        kmpScanRange(text, pattern, next, warmup, lo, hi, found[t]);
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t)
+    {
+        pool.emplace_back(scan, t);
+    }
+    scan(0); // The calling thread takes the first chunk
+    for (std::thread &th : pool)
+    {
+        th.join();
+    }
+
+    std::size_t total = 0;
+    for (const std::vector<long long> &part : found)
+    {
+        total += part.size();
+    }
+    match_indices.reserve(total);
+    for (const std::vector<long long> &part : found)
+    {
+        match_indices.insert(match_indices.end(), part.begin(), part.end());
+    }
+    return match_indices;
+}
+
+#endif // PARALLELKMP_H
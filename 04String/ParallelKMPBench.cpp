@@ -0,0 +1,74 @@
+#include <iostream>
+#include <iomanip> // For std::setw
+#include <string>
+#include <vector>
+#include <random>
+#include <thread>
+#include <algorithm> // For std::max
+#include <cstdlib> // For std::atoll
+#include "StringMatch.h"
+#include "ParallelKMP.h"
+#include "FileMatch.h"
+#include "BenchUtil.h"
+
+/**
+ * Benchmark: kmpParallelMatchAll throughput (GB/s) per thread count.
+ * The text is DnaText (random over {a, c, g, t}) and may be larger than
+ * 2 GB; patterns are a random 16-byte substring and a self-overlapping "aaaa"
+ * (many matches, frequent Next jumps). Each time is the best of three runs;
+ * speedups are relative to one thread. Every result is compared with
+ * parallelMatchAll over kmpMatchAll (FileMatch.h), which finds the matches
+ * chunk by chunk and so also works past int indices.
+ *
+ * Usage: ParallelKMPBench [text size in MB, default 256]
+ */
+
+int main(int argc, char *argv[])
+{
+    long long mb = argc >= 2 ? std::atoll(argv[1]) : 256;
+    if (mb <= 0)
+    {
+        std::cerr << "Text size must be at least 1 MB." << std::endl;
+        return 1;
+    }
+    unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << "--- Parallel KMP Benchmark (" << mb << " MB text, " << hw << " hardware threads) ---" << std::endl;
+    std::mt19937 rng(2025);
+    std::string text = DnaText(static_cast<std::size_t>(mb) << 20, rng);
+    std::vector<std::string> patterns = {text.substr(text.size() / 2, 16), "aaaa"};
+
+    for (const std::string &P : patterns)
+    {
+        std::vector<long long> expected = parallelMatchAll(text, P, static_cast<MatchFunction>(kmpMatchAll), 1);
+
+        std::cout << "\nPattern \"" << P << "\" (" << expected.size() << " matches)" << std::endl;
+        std::cout << std::setw(10) << "threads" << std::setw(12) << "ms" << std::setw(12) << "GB/s" << std::setw(12)
+                  << "speedup" << std::endl;
+
+        double one_thread_ms = 0;
+        for (unsigned threads = 1; threads <= std::max(32u, hw); threads *= 2)
+        {
+            double best = 0;
+            std::vector<long long> got;
+            for (int run = 0; run < 3; ++run)
+            {
+                Clock::time_point start = Clock::now();
+                got = kmpParallelMatchAll(text, P, threads);
+                double ms = ElapsedMs(start);
+                if (run == 0 || ms < best)
+                    best = ms;
+            }
+            if (threads == 1)
+                one_thread_ms = best;
+            std::cout << std::fixed << std::setprecision(2) << std::setw(10) << threads << std::setw(12) << best
+                      << std::setw(12) << text.size() / best / 1e6 << std::setw(12) << one_thread_ms / best
+                      << std::endl;
+            if (got != expected)
+                std::cout << "Mismatch: " << threads << " threads disagree with parallelMatchAll!" << std::endl;
+        }
+    }
+
+    std::cout << "\n--- Benchmark Complete ---" << std::endl;
+    return 0;
+}
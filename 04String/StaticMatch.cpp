@@ -0,0 +1,59 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include "StringMatch.h"
+#include "StaticMatch.h"
+
+// Built by the compiler: a wrong table fails the build, not the run
+constexpr StaticMatcher kAba("aba");
+constexpr StaticMatcher kAbabaca("ababaca");
+static_assert(kAbabaca.nextTable()[4] == 3 && kAbabaca.nextTable()[5] == 0 && kAbabaca.nextTable()[6] == 1,
+              "Next table of ababaca is 0 0 1 2 3 0 1");
+static_assert(kAbabaca.transition(5, 'b') == 4, "After ababa, a mismatching b falls back to abab");
+static_assert(kAba.contains("xxabaxx") && !kAba.contains("abba"), "contains() runs at compile time too");
+
+int main()
+{
+    std::string T = "ababaabaaababa";
+
+    std::cout << "Target String (T): " << T << std::endl;
+    std::cout << "Pattern String (P): " << kAba.str() << " (fixed at compile time)" << std::endl;
+    std::cout << "------------------------------------------" << std::endl;
+
+    std::cout << "Next table: ";
+    for (int v : kAba.nextTable())
+    {
+        std::cout << v << " ";
+    }
+    std::cout << std::endl;
+
+    std::cout << "Pattern found at indices: ";
+    for (int pos : kAba.matchAll(T))
+    {
+        std::cout << pos << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "Count: " << kAba.count(T) << ", DFA size: " << sizeof(kAba) << " bytes" << std::endl;
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+    std::cout << "C++20 staticMatchAll<\"aba\">: ";
+    for (int pos : staticMatchAll<"aba">(T))
+    {
+        std::cout << pos << " ";
+    }
+    std::cout << std::endl;
+#endif
+
+    // --- Cross-check against kmpMatchAll ---
+    std::cout << "\nCross-check against kmpMatchAll on random text:" << std::endl;
+    std::mt19937 rng(2025);
+    std::string text(1 << 20, 'a');
+    for (char &c : text)
+        c = static_cast<char>('a' + rng() % 3);
+    bool same = kAba.matchAll(text) == kmpMatchAll(text, "aba") &&
+                kAbabaca.matchAll(text) == kmpMatchAll(text, "ababaca");
+    std::cout << "Same results as kmpMatchAll: " << (same ? "Yes" : "No") << std::endl;
+
+    return 0;
+}
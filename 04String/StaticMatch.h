@@ -0,0 +1,181 @@
+#ifndef STATICMATCH_H
+#define STATICMATCH_H
+
+#include <array>
+#include <vector>
+#include <string_view>
+#include <cstddef>     // For std::size_t
+#include <cstdint>     // For std::uint8_t, std::uint16_t
+#include <type_traits> // For std::conditional_t
+
+/******************************************************************************
+ * Compile-Time KMP for Fixed Patterns
+ *
+ * For a pattern known when the program is built, the Next table and the whole
+ * KMP automaton can be computed by the compiler. The result lives in a
+ * std::array inside a constexpr object: nothing is computed or allocated at
+ * run time.
+ *
+ * Instead of following Next links on a mismatch, the automaton is expanded
+ * into a complete DFA, delta[j][c] = state after reading byte c in state j,
+ * so the scan does exactly one table lookup per text byte.
+ *
+ *   constexpr StaticMatcher kError("ERROR");   // C++17: type deduced from the literal
+ *   std::vector<int> hits = kError.matchAll(line);
+ *   std::vector<int> hits = staticMatchAll<"ERROR">(line); // C++20
+ ******************************************************************************/
+
+/**
+ * @brief constexpr version of computeNextTable for a string literal.
+ * @param pattern A string literal; its terminating '\0' is not part of the pattern.
+ * @return next[i] = length of the longest proper prefix of P[0..i] that is also its suffix.
+ */
+template <std::size_t N>
+constexpr std::array<int, N - 1> constexprNextTable(const char (&pattern)[N])
+{
+    std::array<int, N - 1> next{};
+    int j = 0;
+    for (std::size_t i = 1; i < N - 1; ++i)
+    {
+        while (j > 0 && pattern[i] != pattern[j])
+        {
+            j = next[j - 1];
+        }
+        if (pattern[i] == pattern[j])
+        {
+            j++;
+        }
+        next[i] = j;
+    }
+    return next;
+}
+
+/**
+ * @class StaticMatcher
+ * @brief KMP automaton for a fixed pattern, built at compile time.
+ * N is the size of the literal (pattern length + 1). States are the number of
+ * matched pattern characters, 0..m; state m reports a match.
+ */
+template <std::size_t N>
+class StaticMatcher
+{
+public:
+    static constexpr std::size_t length = N - 1;
+    static_assert(length >= 1, "StaticMatcher needs a non-empty pattern");
+    static_assert(length < 65535, "StaticMatcher pattern is too long for 16-bit states");
+
+    // Smallest type that holds every state, to keep the table small
+    typedef std::conditional_t<(length < 255), std::uint8_t, std::uint16_t> State;
+
+private:
+    std::array<char, length> pattern{};
+    std::array<int, length> next{};
+    std::array<std::array<State, 256>, length + 1> delta{};
+
+public:
+    constexpr explicit StaticMatcher(const char (&literal)[N]) : next(constexprNextTable(literal))
+    {
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            pattern[i] = literal[i];
+        }
+        // Row j is row Next[j-1] (where a mismatch would fall back to),
+        // except for the byte that extends the match.
+        for (std::size_t j = 0; j <= length; ++j)
+        {
+            for (std::size_t c = 0; c < 256; ++c)
+            {
+                delta[j][c] = j == 0 ? 0 : delta[next[j - 1]][c];
+            }
+            if (j < length)
+            {
+                delta[j][static_cast<unsigned char>(literal[j])] = static_cast<State>(j + 1);
+            }
+        }
+    }
+
+    constexpr std::string_view str() const { return std::string_view(pattern.data(), length); }
+    constexpr const std::array<int, length> &nextTable() const { return next; }
+
+    // transition: State after reading byte c in state j.
+    constexpr State transition(State j, unsigned char c) const { return delta[j][c]; }
+
+    // forEachMatch: Calls on_match(start) for every occurrence, in order.
+    template <typename OnMatch>
+    void forEachMatch(std::string_view text, OnMatch on_match) const
+    {
+        State s = 0;
+        for (std::size_t i = 0; i < text.size(); ++i)
+        {
+            s = delta[s][static_cast<unsigned char>(text[i])];
+            if (s == length)
+            {
+                on_match(static_cast<int>(i + 1 - length));
+            }
+        }
+    }
+
+    // matchAll: Same result as kmpMatchAll(text, pattern).
+    std::vector<int> matchAll(std::string_view text) const
+    {
+        std::vector<int> match_indices;
+        forEachMatch(text, [&match_indices](int pos) { match_indices.push_back(pos); });
+        return match_indices;
+    }
+
+    // count: Number of occurrences; allocates nothing.
+    std::size_t count(std::string_view text) const
+    {
+        std::size_t total = 0;
+        forEachMatch(text, [&total](int) { total++; });
+        return total;
+    }
+
+    // contains: Stops at the first occurrence.
+    constexpr bool contains(std::string_view text) const
+    {
+        State s = 0;
+        for (std::size_t i = 0; i < text.size(); ++i)
+        {
+            s = delta[s][static_cast<unsigned char>(text[i])];
+            if (s == length)
+                return true;
+        }
+        return false;
+    }
+};
+
+// Lets "constexpr StaticMatcher m("abc");" deduce N from the literal
+template <std::size_t N>
+StaticMatcher(const char (&)[N]) -> StaticMatcher<N>;
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+/**
+ * @brief C++20: a string literal usable as a template argument.
+ */
+template <std::size_t N>
+struct FixedString
+{
+    char chars[N];
+    constexpr FixedString(const char (&literal)[N])
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            chars[i] = literal[i];
+        }
+    }
+};
+
+// One automaton per distinct literal, built at compile time
+template <FixedString P>
+inline constexpr StaticMatcher<sizeof(P.chars)> staticMatcher{P.chars};
+
+// staticMatchAll<"pattern">(text): Same result as kmpMatchAll(text, "pattern").
+template <FixedString P>
+std::vector<int> staticMatchAll(std::string_view text)
+{
+    return staticMatcher<P>.matchAll(text);
+}
+#endif
+
+#endif // STATICMATCH_H
@@ -0,0 +1,650 @@
+#ifndef STRINGMATCH_H
+#define STRINGMATCH_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm> // for std::max
+#include <cstring>   // for std::memchr, std::memcmp
+#include <climits>   // for INT_MAX
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h> // AVX2 intrinsics, enabled per function (no -mavx2 needed)
+#define STRINGMATCH_X86_SIMD 1
+#endif
+
+// Define the size of the character set (e.g., ASCII)
+const int ALPHABET_SIZE = 256;
+
+// All matchers take std::string_view, so a std::string, a string literal or a
+// raw (pointer, length) span such as a memory-mapped file can be searched
+// without copying. Indices are int: callers split larger inputs into chunks
+// (see FileMatch.h).
+
+/******************************************************************************
+ * Instrumentation
+ ******************************************************************************/
+
+// Counters filled by the instrumented overloads of bruteForceMatchAll,
+// kmpMatchAll and horspoolMatchAll (and of computeNextTable), which take a
+// stats object as their last argument. The algorithm code only calls the
+// hooks; which policy is passed decides at compile time what they cost.
+struct MatchStats
+{
+    long long comparisons = 0; // Character comparisons, including preprocessing
+    long long shifts = 0;      // Moves of the pattern along the text
+    long long lookups = 0;     // Reads of a shift or next table
+
+    void compare() { comparisons++; }
+    void shift() { shifts++; }
+    void lookup() { lookups++; }
+};
+
+// Policy of the plain two-argument matchers: the hooks are empty and inline away,
+// so these compile to the same code as an uninstrumented matcher.
+struct NoStats
+{
+    void compare() {}
+    void shift() {}
+    void lookup() {}
+};
+
+// equalCounted: a == b, reported to the stats policy.
+template <typename Stats>
+inline bool equalCounted(char a, char b, Stats &stats)
+{
+    stats.compare();
+    return a == b;
+}
+
+/******************************************************************************
+ * Brute-Force Algorithm
+ ******************************************************************************/
+template <typename Stats>
+std::vector<int> bruteForceMatchAll(std::string_view text, std::string_view pattern, Stats &stats)
+{
+    std::vector<int> match_indices;
+    int n = text.length();
+    int m = pattern.length();
+    if (m == 0)
+        return match_indices;
+    for (int i = 0; i <= n - m; ++i)
+    {
+        int j = 0;
+        while (j < m && equalCounted(text[i + j], pattern[j], stats))
+        {
+            j++;
+        }
+        if (j == m)
+        {
+            match_indices.push_back(i);
+        }
+        stats.shift();
+    }
+    return match_indices;
+}
+
+inline std::vector<int> bruteForceMatchAll(std::string_view text, std::string_view pattern)
+{
+    NoStats none;
+    return bruteForceMatchAll(text, pattern, none);
+}
+
+/******************************************************************************
+ * KMP Algorithm
+ ******************************************************************************/
+template <typename Stats>
+std::vector<int> computeNextTable(std::string_view pattern, Stats &stats)
+{
+    int m = pattern.length();
+    std::vector<int> next(m, 0);
+    int j = 0;
+    for (int i = 1; i < m; ++i)
+    {
+        while (j > 0 && !equalCounted(pattern[i], pattern[j], stats))
+        {
+            stats.lookup();
+            j = next[j - 1];
+        }
+        if (equalCounted(pattern[i], pattern[j], stats))
+        {
+            j++;
+        }
+        next[i] = j;
+    }
+    return next;
+}
+
+inline std::vector<int> computeNextTable(std::string_view pattern)
+{
+    NoStats none;
+    return computeNextTable(pattern, none);
+}
+
+template <typename Stats>
+std::vector<int> kmpMatchAll(std::string_view text, std::string_view pattern, Stats &stats)
+{
+    int n = text.length();
+    int m = pattern.length();
+    std::vector<int> match_indices;
+    if (m == 0)
+        return match_indices;
+    std::vector<int> next = computeNextTable(pattern, stats);
+    int j = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        while (j > 0 && !equalCounted(text[i], pattern[j], stats))
+        {
+            stats.lookup();
+            stats.shift(); // Alignment i - j moves right by j - next[j - 1]
+            j = next[j - 1];
+        }
+        if (equalCounted(text[i], pattern[j], stats))
+        {
+            j++;
+        }
+        else
+        {
+            stats.shift(); // j == 0: the alignment moves on with i
+        }
+        if (j == m)
+        {
+            match_indices.push_back(i - m + 1);
+            stats.lookup();
+            stats.shift();
+            j = next[j - 1];
+        }
+    }
+    return match_indices;
+}
+
+inline std::vector<int> kmpMatchAll(std::string_view text, std::string_view pattern)
+{
+    NoStats none;
+    return kmpMatchAll(text, pattern, none);
+}
+
+/******************************************************************************
+ * Horspool Algorithm (newly added)
+ ******************************************************************************/
+
+/**
+ * @brief Builds the shift table for the Horspool algorithm.
+ * This table stores the last occurrence index of each character in the pattern.
+ *
+ * @param pattern The pattern string P.
+ * @return A std::vector<int> representing the shift table. For a character 'c',
+ * table[c] is the index of its last occurrence in the pattern. If 'c' is not in
+ * the pattern, the value is -1.
+ */
+inline std::vector<int> buildShiftTable(std::string_view pattern)
+{
+    int m = pattern.length();
+    std::vector<int> table(ALPHABET_SIZE, -1);
+
+    // Store the last occurrence of each character found in the pattern.
+    // We don't include the last character of the pattern itself in this calculation
+    // for the most common variant of the shift logic.
+    for (int i = 0; i < m - 1; ++i)
+    {
+        table[static_cast<unsigned char>(pattern[i])] = i;
+    }
+    return table;
+}
+
+/**
+ * @brief Finds all occurrences of a pattern in a text using the Horspool algorithm.
+ *
+ * This function uses a precomputed shift table based on the "bad character" heuristic.
+ * It compares the pattern from right to left.
+ *
+ * @param text The string to be searched in (Target string T).
+ * @param pattern The string to search for (Pattern string P).
+ * @param stats Counters (MatchStats), or NoStats in the two-argument overload.
+ * @return A std::vector<int> containing the starting indices of all occurrences.
+ */
+template <typename Stats>
+std::vector<int> horspoolMatchAll(std::string_view text, std::string_view pattern, Stats &stats)
+{
+    int n = text.length();
+    int m = pattern.length();
+    std::vector<int> match_indices;
+
+    if (m == 0 || n < m)
+        return match_indices;
+
+    // Step 1: Preprocess the pattern to get the shift table.
+    std::vector<int> table = buildShiftTable(pattern);
+
+    int i = 0; // i is the starting index of the alignment window in the text
+    while (i <= n - m)
+    {
+        // Get the character in the text that aligns with the last char of the pattern
+        char c = text[i + m - 1];
+
+        // Compare this character with the last character of the pattern
+        if (equalCounted(c, pattern[m - 1], stats))
+        {
+            // If they match, check the rest of the pattern from right to left
+            int j = m - 2;
+            while (j >= 0 && equalCounted(text[i + j], pattern[j], stats))
+            {
+                j--;
+            }
+            // If the inner loop completed, we have a full match
+            if (j < 0)
+            {
+                match_indices.push_back(i);
+            }
+        }
+
+        // Calculate the shift to the next position.
+        // The shift is based on the last occurrence of character 'c' in the pattern.
+        stats.lookup();
+        stats.shift();
+        int shift = m - 1 - table[static_cast<unsigned char>(c)];
+        i += shift;
+    }
+
+    return match_indices;
+}
+
+inline std::vector<int> horspoolMatchAll(std::string_view text, std::string_view pattern)
+{
+    NoStats none;
+    return horspoolMatchAll(text, pattern, none);
+}
+
+/******************************************************************************
+ * SIMD First/Last-Byte Filter
+ ******************************************************************************/
+
+#ifdef STRINGMATCH_X86_SIMD
+// simdFilterAVX2: tests 32 windows per step; returns the first window not yet tested
+__attribute__((target("avx2"))) inline int simdFilterAVX2(const char *t, const char *p, int m, int last_window,
+                                                          std::vector<int> &match_indices)
+{
+    const __m256i first = _mm256_set1_epi8(p[0]);
+    const __m256i last = _mm256_set1_epi8(p[m - 1]);
+    int i = 0;
+    for (; i + 31 <= last_window; i += 32)
+    {
+        __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(t + i));
+        __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(t + i + m - 1));
+        __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last));
+        unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(eq));
+        while (mask != 0)
+        {
+            int k = i + __builtin_ctz(mask); // Lowest candidate first, so results stay ordered
+            if (m <= 2 || std::memcmp(t + k + 1, p + 1, m - 2) == 0)
+            {
+                match_indices.push_back(k);
+            }
+            mask &= mask - 1;
+        }
+    }
+    return i;
+}
+#endif
+
+// hasAVX2: whether the running CPU supports AVX2 (checked once)
+inline bool hasAVX2()
+{
+#ifdef STRINGMATCH_X86_SIMD
+    static const bool supported = []
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Finds all occurrences of a pattern by filtering on its first and last bytes.
+ *
+ * A window starting at i can only match if text[i] == P[0] and
+ * text[i + m - 1] == P[m - 1]. On CPUs with AVX2 (checked at run time), both
+ * bytes are compared against 32 consecutive windows at once (two unaligned
+ * loads, two compares, one AND); each set bit of the resulting mask is a
+ * candidate, verified with memcmp on the middle bytes. Otherwise (and for the
+ * last < 32 windows) the scalar path jumps between occurrences of P[0] with
+ * memchr and applies the same test.
+ *
+ * @param text The string to be searched in (Target string T).
+ * @param pattern The string to search for (Pattern string P).
+ * @return A std::vector<int> containing the starting indices of all occurrences.
+ */
+inline std::vector<int> simdMatchAll(std::string_view text, std::string_view pattern)
+{
+    int n = text.length();
+    int m = pattern.length();
+    std::vector<int> match_indices;
+
+    if (m == 0 || n < m)
+        return match_indices;
+
+    const char *t = text.data();
+    const char *p = pattern.data();
+    const int last_window = n - m; // Start of the last possible match
+    int i = 0;
+
+#ifdef STRINGMATCH_X86_SIMD
+    if (hasAVX2())
+        i = simdFilterAVX2(t, p, m, last_window, match_indices);
+#endif
+
+    // Scalar path: remaining windows (all of them without AVX2)
+    while (i <= last_window)
+    {
+        const void *hit = std::memchr(t + i, p[0], last_window - i + 1);
+        if (hit == nullptr)
+            break;
+        i = static_cast<int>(static_cast<const char *>(hit) - t);
+        if (t[i + m - 1] == p[m - 1] && (m <= 2 || std::memcmp(t + i + 1, p + 1, m - 2) == 0))
+        {
+            match_indices.push_back(i);
+        }
+        i++;
+    }
+
+    return match_indices;
+}
+
+/******************************************************************************
+ * Boyer-Moore Algorithm (bad character + good suffix)
+ ******************************************************************************/
+
+/**
+ * @brief Builds the good-suffix shift table for the Boyer-Moore algorithm.
+ *
+ * suffix[i] is the length of the longest substring ending at i that is also a
+ * suffix of P. If a mismatch happens at P[j] after P[j+1..m-1] matched, the
+ * pattern can shift to the next place where that matched suffix occurs again
+ * (preceded by a different character), or else to the longest prefix of P
+ * that is also a suffix of the matched part.
+ *
+ * @param pattern The pattern string P.
+ * @return table[j] = shift after a mismatch at position j; table[0] is also
+ * the shift after a full match.
+ */
+inline std::vector<int> buildGoodSuffixTable(std::string_view pattern)
+{
+    int m = pattern.length();
+    std::vector<int> suffix(m, 0);
+    std::vector<int> table(m, m);
+    if (m == 0)
+        return table;
+
+    // suffix[] in O(m), reusing the box [g+1, f] found by earlier comparisons
+    suffix[m - 1] = m;
+    int f = m - 1, g = m - 1;
+    for (int i = m - 2; i >= 0; --i)
+    {
+        if (i > g && suffix[i + m - 1 - f] < i - g)
+        {
+            suffix[i] = suffix[i + m - 1 - f];
+        }
+        else
+        {
+            if (i < g)
+                g = i;
+            f = i;
+            while (g >= 0 && pattern[g] == pattern[g + m - 1 - f])
+            {
+                g--;
+            }
+            suffix[i] = f - g;
+        }
+    }
+
+    // Case 2: only a prefix of P matches a suffix of the matched part
+    int j = 0;
+    for (int i = m - 1; i >= 0; --i)
+    {
+        if (suffix[i] == i + 1)
+        {
+            for (; j < m - 1 - i; ++j)
+            {
+                if (table[j] == m)
+                    table[j] = m - 1 - i;
+            }
+        }
+    }
+    // Case 1: the matched suffix occurs again inside P
+    for (int i = 0; i <= m - 2; ++i)
+    {
+        table[m - 1 - suffix[i]] = m - 1 - i;
+    }
+    return table;
+}
+
+/**
+ * @brief Finds all occurrences of a pattern in a text using the Boyer-Moore algorithm.
+ *
+ * Compares right to left like Horspool, but after a mismatch at P[j] shifts by
+ * the larger of the bad-character rule (align the mismatched text character
+ * with its last occurrence in P[0..j-1], reusing buildShiftTable) and the
+ * good-suffix rule. The good-suffix rule keeps long shifts on small alphabets,
+ * where the bad-character rule alone degrades to shifts of 1.
+ *
+ * @param text The string to be searched in (Target string T).
+ * @param pattern The string to search for (Pattern string P).
+ * @return A std::vector<int> containing the starting indices of all occurrences.
+ */
+inline std::vector<int> boyerMooreMatchAll(std::string_view text, std::string_view pattern)
+{
+    int n = text.length();
+    int m = pattern.length();
+    std::vector<int> match_indices;
+
+    if (m == 0 || n < m)
+        return match_indices;
+
+    std::vector<int> last = buildShiftTable(pattern); // Last occurrence in P[0..m-2]
+    std::vector<int> good_suffix = buildGoodSuffixTable(pattern);
+
+    int i = 0;
+    while (i <= n - m)
+    {
+        int j = m - 1;
+        while (j >= 0 && text[i + j] == pattern[j])
+        {
+            j--;
+        }
+        if (j < 0)
+        {
+            match_indices.push_back(i);
+            i += good_suffix[0];
+        }
+        else
+        {
+            int bad_char = j - last[static_cast<unsigned char>(text[i + j])];
+            i += std::max(good_suffix[j], bad_char);
+        }
+    }
+    return match_indices;
+}
+
+/******************************************************************************
+ * Sunday (Quick Search) Algorithm
+ ******************************************************************************/
+
+/**
+ * @brief Finds all occurrences of a pattern in a text using the Sunday algorithm.
+ *
+ * The shift is decided by the character just AFTER the window, T[i+m]: align
+ * its last occurrence in P with it, or skip past it (shift m+1) if it is not
+ * in P. The window itself can be compared in any order; left to right here.
+ *
+ * @param text The string to be searched in (Target string T).
+ * @param pattern The string to search for (Pattern string P).
+ * @return A std::vector<int> containing the starting indices of all occurrences.
+ */
+inline std::vector<int> sundayMatchAll(std::string_view text, std::string_view pattern)
+{
+    int n = text.length();
+    int m = pattern.length();
+    std::vector<int> match_indices;
+
+    if (m == 0 || n < m)
+        return match_indices;
+
+    // Unlike buildShiftTable, the last character of P counts too
+    std::vector<int> shift(ALPHABET_SIZE, m + 1);
+    for (int k = 0; k < m; ++k)
+    {
+        shift[static_cast<unsigned char>(pattern[k])] = m - k;
+    }
+
+    int i = 0;
+    while (i <= n - m)
+    {
+        int j = 0;
+        while (j < m && text[i + j] == pattern[j])
+        {
+            j++;
+        }
+        if (j == m)
+        {
+            match_indices.push_back(i);
+        }
+        if (i == n - m)
+            break; // No character after the last window
+        i += shift[static_cast<unsigned char>(text[i + m])];
+    }
+    return match_indices;
+}
+
+/******************************************************************************
+ * Raita Algorithm
+ ******************************************************************************/
+
+/**
+ * @brief Finds all occurrences of a pattern in a text using the Raita algorithm.
+ *
+ * Horspool's shift, but each window is checked last character first, then the
+ * first, then the middle one, and only then the rest (with memcmp). Real
+ * texts have dependencies between neighbouring characters, so testing spread
+ * out positions first rejects most windows sooner.
+ *
+ * @param text The string to be searched in (Target string T).
+ * @param pattern The string to search for (Pattern string P).
+ * @return A std::vector<int> containing the starting indices of all occurrences.
+ */
+inline std::vector<int> raitaMatchAll(std::string_view text, std::string_view pattern)
+{
+    int n = text.length();
+    int m = pattern.length();
+    std::vector<int> match_indices;
+
+    if (m == 0 || n < m)
+        return match_indices;
+
+    std::vector<int> table = buildShiftTable(pattern);
+    const char first = pattern[0];
+    const char middle = pattern[m / 2];
+    const char last = pattern[m - 1];
+
+    int i = 0;
+    while (i <= n - m)
+    {
+        char c = text[i + m - 1];
+        if (c == last && text[i] == first && text[i + m / 2] == middle &&
+            (m <= 2 || std::memcmp(text.data() + i + 1, pattern.data() + 1, m - 2) == 0))
+        {
+            match_indices.push_back(i);
+        }
+        i += m - 1 - table[static_cast<unsigned char>(c)];
+    }
+    return match_indices;
+}
+
+/******************************************************************************
+ * Algorithm Selection
+ ******************************************************************************/
+
+// Thresholds for selectMatcher(), calibrated with MatchSelectBench.cpp.
+const int MATCH_SMALL_TEXT = 4096;   // Shorter texts: no matcher with tables pays off
+const int MATCH_SAMPLE_BYTES = 256;  // Text prefix used to estimate the alphabet size
+const int MATCH_SMALL_ALPHABET = 4;  // At most this many distinct bytes: DNA-like text
+
+// MatchThresholds: pattern-length limits that depend on how fast simdMatchAll() runs
+struct MatchThresholds
+{
+    int bm_min_pattern;         // Longer patterns on small alphabets: Boyer-Moore
+    int bm_max_alphabet;        // ... but only up to this many distinct bytes
+    int simd_max_pattern_small; // Other patterns on small alphabets: SIMD filter up to this length, then Sunday
+    int simd_max_pattern;       // Larger alphabets: SIMD filter up to this length, then Sunday
+};
+
+// AVX2 filter: it beat Sunday at every calibrated pattern length, so the SIMD
+// limits are INT_MAX (Sunday is never picked) and Boyer-Moore only takes long
+// patterns on (near-)binary text.
+const MatchThresholds MATCH_THRESHOLDS_AVX2 = {128, 2, INT_MAX, INT_MAX};
+// Scalar filter: memchr only wins for short patterns; Sunday's shifts beat it beyond.
+const MatchThresholds MATCH_THRESHOLDS_SCALAR = {16, MATCH_SMALL_ALPHABET, 2, 16};
+
+// matchThresholds: the threshold set for the path simdMatchAll() takes on this CPU
+inline const MatchThresholds &matchThresholds()
+{
+    return hasAVX2() ? MATCH_THRESHOLDS_AVX2 : MATCH_THRESHOLDS_SCALAR;
+}
+
+typedef std::vector<int> (*MatchFunction)(std::string_view, std::string_view);
+
+/**
+ * @brief Picks the matcher expected to be fastest for this text and pattern.
+ *
+ * Short texts always use the SIMD filter, which needs no tables. For longer
+ * texts, the alphabet size is estimated from the first MATCH_SAMPLE_BYTES of the
+ * text. Small alphabets make the first/last-byte filter pass too many
+ * candidates and keep bad-character shifts short, so they go to Boyer-Moore
+ * (long patterns, where the good-suffix rule pays off) or Sunday. Otherwise
+ * the SIMD filter is used; on CPUs without AVX2, Sunday takes the longer
+ * patterns. The limits come from matchThresholds(), chosen at run time.
+ *
+ * @return One of the xxxMatchAll functions.
+ */
+inline MatchFunction selectMatcher(std::string_view text, std::string_view pattern)
+{
+    int m = pattern.length();
+    if (m == 0 || text.length() < pattern.length())
+        return bruteForceMatchAll; // Nothing to find; no preprocessing
+    if (text.length() < static_cast<std::size_t>(MATCH_SMALL_TEXT))
+        return simdMatchAll; // Building a 256-entry table would cost more than the scan
+
+    bool seen[ALPHABET_SIZE] = {false};
+    int sigma = 0;
+    std::size_t sample = std::min<std::size_t>(text.length(), MATCH_SAMPLE_BYTES);
+    for (std::size_t i = 0; i < sample; ++i)
+    {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        if (!seen[c])
+        {
+            seen[c] = true;
+            sigma++;
+        }
+    }
+
+    const MatchThresholds &limits = matchThresholds();
+    if (sigma <= MATCH_SMALL_ALPHABET)
+    {
+        if (sigma <= limits.bm_max_alphabet && m >= limits.bm_min_pattern)
+            return boyerMooreMatchAll;
+        return m <= limits.simd_max_pattern_small ? simdMatchAll : sundayMatchAll;
+    }
+    return m <= limits.simd_max_pattern ? simdMatchAll : sundayMatchAll;
+}
+
+/**
+ * @brief Finds all occurrences of a pattern with the matcher chosen by selectMatcher().
+ * @return A std::vector<int> containing the starting indices of all occurrences.
+ */
+inline std::vector<int> matchAll(std::string_view text, std::string_view pattern)
+{
+    return selectMatcher(text, pattern)(text, pattern);
+}
+
+#endif // STRINGMATCH_H
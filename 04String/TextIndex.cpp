@@ -0,0 +1,83 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm> // For std::sort
+#include "StringMatch.h"
+#include "TextIndex.h"
+
+// Suffix array by sorting the suffixes directly, O(n^2 log n): the reference.
+std::vector<int> naiveSuffixArray(const std::string &s)
+{
+    std::vector<int> sa(s.size());
+    for (std::size_t i = 0; i < s.size(); ++i)
+        sa[i] = static_cast<int>(i);
+    std::sort(sa.begin(), sa.end(), [&s](int a, int b) { return s.compare(a, std::string::npos, s, b, std::string::npos) < 0; });
+    return sa;
+}
+
+int main()
+{
+    std::string T = "banana";
+    TextIndex index(T);
+
+    std::cout << "Target String (T): " << T << std::endl;
+    std::cout << "------------------------------------------" << std::endl;
+    std::cout << "  i  SA[i]  LCP[i]  suffix" << std::endl;
+    for (std::size_t i = 0; i < index.size(); ++i)
+    {
+        int pos = index.suffixArray()[i];
+        std::cout << "  " << i << "  " << pos << "      " << index.lcpArray()[i] << "       " << T.substr(pos) << std::endl;
+    }
+    std::cout << "count(\"ana\") = " << index.count("ana") << ", locate(\"ana\") = ";
+    for (int pos : index.locate("ana"))
+    {
+        std::cout << pos << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "count(\"nab\") = " << index.count("nab") << std::endl;
+    std::cout << "Longest repeated substring: \"" << index.longestRepeat() << "\"" << std::endl;
+
+    // --- SA-IS against sorting the suffixes, on many small strings ---
+    std::cout << "\nSA-IS against sorted suffixes:" << std::endl;
+    std::mt19937 rng(2025);
+    bool same = true;
+    for (int trial = 0; trial < 2000 && same; ++trial)
+    {
+        std::string s(rng() % 200, 'a');
+        int sigma = 1 + rng() % 4;
+        for (char &c : s)
+            c = static_cast<char>('a' + rng() % sigma);
+        TextIndex small(s);
+        same = small.suffixArray() == naiveSuffixArray(s);
+    }
+    std::cout << "Same suffix arrays for 2000 random strings: " << (same ? "Yes" : "No") << std::endl;
+
+    // --- Queries against kmpMatchAll ---
+    std::cout << "\nQueries against kmpMatchAll:" << std::endl;
+    std::string text(200000, 'a');
+    for (char &c : text)
+        c = static_cast<char>('a' + rng() % 3);
+    TextIndex big(text);
+    std::vector<std::string> patterns;
+    for (int k = 0; k < 500; ++k)
+    {
+        std::size_t len = 1 + rng() % 12;
+        if (k % 5 == 0)
+            patterns.push_back(std::string(len, 'd')); // Not in the text
+        else
+            patterns.push_back(text.substr(rng() % (text.size() - len), len));
+    }
+    std::vector<std::vector<int>> located = big.locateBatch(patterns, 4);
+    std::vector<std::size_t> counted = big.countBatch(patterns, 4);
+    same = true;
+    for (std::size_t k = 0; k < patterns.size(); ++k)
+    {
+        std::vector<int> expected = kmpMatchAll(text, patterns[k]);
+        same = same && located[k] == expected && counted[k] == expected.size();
+    }
+    std::cout << "Same results for " << patterns.size() << " patterns (4 threads): " << (same ? "Yes" : "No") << std::endl;
+    std::cout << "Index size: " << big.memoryBytes() << " bytes for " << big.size() << " characters" << std::endl;
+
+    return 0;
+}
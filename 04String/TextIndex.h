@@ -0,0 +1,372 @@
+#ifndef TEXTINDEX_H
+#define TEXTINDEX_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cstddef>   // For std::size_t
+#include <algorithm> // For std::fill, std::copy, std::sort, std::min
+#include <stdexcept> // For throwing exceptions
+#include <climits>   // For INT_MAX
+#include <utility>   // For std::pair, std::move
+
+/******************************************************************************
+ * Suffix Array Index
+ *
+ * All the matchers in StringMatch.h scan the whole text for every query. When
+ * one text is searched many times, it pays to sort all of its suffixes once:
+ * the occurrences of P are then exactly the suffixes that start with P, which
+ * form one contiguous range of the suffix array and are found by binary
+ * search in O(m log n), independent of how often P occurs.
+ *
+ *   - suffixArraySAIS builds the suffix array in O(n) with SA-IS (induced
+ *     sorting): suffixes are classified as S-type (smaller than the next
+ *     suffix) or L-type; only the leftmost S-type ("LMS") suffixes are sorted
+ *     directly (recursively, on a string of LMS substring names), and the
+ *     order of all other suffixes is induced from them in two linear passes.
+ *   - lcpArrayKasai computes LCP[i] = longest common prefix of the suffixes
+ *     at SA[i-1] and SA[i] in O(n).
+ *
+ * Memory: 4 bytes per character for SA and 4 for LCP, plus the text.
+ ******************************************************************************/
+
+/**
+ * @brief Builds the suffix array of s with SA-IS.
+ * @tparam Index A signed integer type that holds every position of s (int,
+ * or std::int64_t for texts of 2 GiB and more).
+ * @param s The string, as integers in [0, upper].
+ * @param upper Largest value in s.
+ * @return SA: the starting positions of the suffixes of s in lexicographic order.
+ */
+template <typename Index>
+std::vector<Index> suffixArraySAIS(const std::vector<Index> &s, Index upper)
+{
+    Index n = static_cast<Index>(s.size());
+    if (n == 0)
+        return {};
+    if (n == 1)
+        return {0};
+    if (n == 2)
+        return s[0] < s[1] ? std::vector<Index>{0, 1} : std::vector<Index>{1, 0};
+
+    std::vector<Index> sa(n);
+    std::vector<bool> is_s(n, false); // S-type: suffix i < suffix i+1; the last suffix is L-type
+    for (Index i = n - 2; i >= 0; --i)
+    {
+        is_s[i] = (s[i] == s[i + 1]) ? is_s[i + 1] : (s[i] < s[i + 1]);
+    }
+
+    // Bucket boundaries: within the bucket of character c, L-type suffixes come first
+    std::vector<Index> start_l(upper + 1, 0), start_s(upper + 1, 0);
+    for (Index i = 0; i < n; ++i)
+    {
+        if (!is_s[i])
+            start_s[s[i]]++;
+        else
+            start_l[s[i] + 1]++;
+    }
+    for (Index c = 0; c <= upper; ++c)
+    {
+        start_s[c] += start_l[c];
+        if (c < upper)
+            start_l[c + 1] += start_s[c];
+    }
+
+    // induce: Places the LMS suffixes in 'lms' order, then induces L- and S-type suffixes.
+    std::vector<Index> bucket(upper + 1);
+    auto induce = [&](const std::vector<Index> &lms) {
+        std::fill(sa.begin(), sa.end(), -1);
+        std::copy(start_s.begin(), start_s.end(), bucket.begin());
+        for (Index d : lms)
+        {
+            if (d != n)
+                sa[bucket[s[d]]++] = d;
+        }
+        // L-type, left to right: suffix v-1 is L-type and follows v
+        std::copy(start_l.begin(), start_l.end(), bucket.begin());
+        sa[bucket[s[n - 1]]++] = n - 1;
+        for (Index i = 0; i < n; ++i)
+        {
+            Index v = sa[i];
+            if (v >= 1 && !is_s[v - 1])
+                sa[bucket[s[v - 1]]++] = v - 1;
+        }
+        // S-type, right to left, filling each bucket from its end
+        std::copy(start_l.begin(), start_l.end(), bucket.begin());
+        for (Index i = n - 1; i >= 0; --i)
+        {
+            Index v = sa[i];
+            if (v >= 1 && is_s[v - 1])
+                sa[--bucket[s[v - 1] + 1]] = v - 1;
+        }
+    };
+
+    std::vector<Index> lms_index(n + 1, -1); // Position -> index among LMS positions
+    std::vector<Index> lms;
+    for (Index i = 1; i < n; ++i)
+    {
+        if (!is_s[i - 1] && is_s[i])
+        {
+            lms_index[i] = static_cast<Index>(lms.size());
+            lms.push_back(i);
+        }
+    }
+    Index num_lms = static_cast<Index>(lms.size());
+    induce(lms); // LMS substrings are now sorted (not yet the LMS suffixes)
+
+    if (num_lms > 0)
+    {
+        std::vector<Index> sorted_lms;
+        sorted_lms.reserve(num_lms);
+        for (Index v : sa)
+        {
+            if (lms_index[v] != -1)
+                sorted_lms.push_back(v);
+        }
+        // Name each LMS substring by rank; equal substrings share a name
+        std::vector<Index> reduced(num_lms);
+        Index names = 0;
+        reduced[lms_index[sorted_lms[0]]] = 0;
+        for (Index k = 1; k < num_lms; ++k)
+        {
+            Index l = sorted_lms[k - 1], r = sorted_lms[k];
+            Index end_l = lms_index[l] + 1 < num_lms ? lms[lms_index[l] + 1] : n;
+            Index end_r = lms_index[r] + 1 < num_lms ? lms[lms_index[r] + 1] : n;
+            bool same = true;
+            if (end_l - l != end_r - r)
+            {
+                same = false;
+            }
+            else
+            {
+                while (l < end_l && s[l] == s[r])
+                {
+                    l++;
+                    r++;
+                }
+                if (l == n || s[l] != s[r])
+                    same = false;
+            }
+            if (!same)
+                names++;
+            reduced[lms_index[sorted_lms[k]]] = names;
+        }
+
+        // Sorting the reduced string sorts the LMS suffixes
+        std::vector<Index> reduced_sa = suffixArraySAIS(reduced, names);
+        for (Index k = 0; k < num_lms; ++k)
+        {
+            sorted_lms[k] = lms[reduced_sa[k]];
+        }
+        induce(sorted_lms);
+    }
+    return sa;
+}
+
+/**
+ * @brief Kasai's algorithm: LCP[i] = longest common prefix of the suffixes at SA[i-1] and SA[i].
+ * Walks the suffixes in text order; the LCP drops by at most 1 from one to the next.
+ * @return LCP with LCP[0] = 0.
+ */
+inline std::vector<int> lcpArrayKasai(std::string_view text, const std::vector<int> &sa)
+{
+    int n = text.size();
+    std::vector<int> rank(n), lcp(n, 0);
+    for (int i = 0; i < n; ++i)
+    {
+        rank[sa[i]] = i;
+    }
+    int h = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        if (h > 0)
+            h--;
+        if (rank[i] == 0)
+        {
+            h = 0;
+            continue;
+        }
+        int j = sa[rank[i] - 1];
+        while (i + h < n && j + h < n && text[i + h] == text[j + h])
+        {
+            h++;
+        }
+        lcp[rank[i]] = h;
+    }
+    return lcp;
+}
+
+/**
+ * @class TextIndex
+ * @brief A text with its suffix array and LCP array, for repeated substring queries.
+ */
+class TextIndex
+{
+private:
+    std::string text;
+    std::vector<int> sa;
+    std::vector<int> lcp;
+
+    // compareAt: Compares P with the suffix at 'pos', skipping the first 'skip'
+    // characters already known to match; returns <0, 0 (P is a prefix) or >0,
+    // and the total matched length in 'matched'.
+    int compareAt(std::string_view pattern, int pos, int skip, int &matched) const
+    {
+        int n = text.size();
+        int m = pattern.size();
+        int k = skip;
+        while (k < m && pos + k < n && pattern[k] == text[pos + k])
+        {
+            k++;
+        }
+        matched = k;
+        if (k == m)
+            return 0;
+        if (pos + k == n)
+            return 1; // Suffix ended first: it is smaller than P
+        return static_cast<unsigned char>(pattern[k]) < static_cast<unsigned char>(text[pos + k]) ? -1 : 1;
+    }
+
+    // bound: First SA index whose suffix is >= P (upper = false) or whose
+    // suffix is > P and does not start with P (upper = true). Binary search
+    // where each comparison skips min(matched at lo, matched at hi)
+    // characters, which the suffixes in between must share.
+    int bound(std::string_view pattern, bool upper) const
+    {
+        int lo = -1, hi = sa.size(); // Invariant: suffix(lo) < target <= suffix(hi)
+        int lo_match = 0, hi_match = 0;
+        while (hi - lo > 1)
+        {
+            int mid = lo + (hi - lo) / 2;
+            int matched;
+            int cmp = compareAt(pattern, sa[mid], std::min(lo_match, hi_match), matched);
+            bool go_right = upper ? cmp >= 0 : cmp > 0;
+            if (go_right)
+            {
+                lo = mid;
+                lo_match = matched;
+            }
+            else
+            {
+                hi = mid;
+                hi_match = matched;
+            }
+        }
+        return hi;
+    }
+
+    // forEachParallel: Calls fn(k) for k in [0, total); threads claim blocks of indices.
+    template <typename Fn>
+    static void forEachParallel(std::size_t total, unsigned threads, Fn fn)
+    {
+        const std::size_t kBlock = 64; // Queries per claim: amortizes the atomic
+        if (threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = static_cast<unsigned>(std::min<std::size_t>(threads, (total + kBlock - 1) / kBlock));
+        std::atomic<std::size_t> next(0);
+        auto worker = [&]() {
+            std::size_t first;
+            while ((first = next.fetch_add(kBlock, std::memory_order_relaxed)) < total)
+            {
+                std::size_t last = std::min(total, first + kBlock);
+                for (std::size_t k = first; k < last; ++k)
+                {
+                    fn(k);
+                }
+            }
+        };
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; ++t)
+        {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (std::thread &th : pool)
+        {
+            th.join();
+        }
+    }
+
+public:
+    // Constructor: builds SA and LCP in O(n); throws std::length_error past INT_MAX characters.
+    explicit TextIndex(std::string source) : text(std::move(source))
+    {
+        if (text.size() >= static_cast<std::size_t>(INT_MAX))
+        {
+            throw std::length_error("Error: TextIndex text is too long for int positions.");
+        }
+        std::vector<int> s(text.size());
+        for (std::size_t i = 0; i < text.size(); ++i)
+        {
+            s[i] = static_cast<unsigned char>(text[i]);
+        }
+        sa = suffixArraySAIS(s, 255);
+        lcp = lcpArrayKasai(text, sa);
+    }
+
+    std::size_t size() const { return text.size(); }
+    const std::string &str() const { return text; }
+    const std::vector<int> &suffixArray() const { return sa; }
+    const std::vector<int> &lcpArray() const { return lcp; }
+
+    // Bytes used by the index, excluding the text itself
+    std::size_t memoryBytes() const { return (sa.capacity() + lcp.capacity()) * sizeof(int); }
+
+    // range: The SA interval [first, last) of the suffixes that start with P.
+    std::pair<int, int> range(std::string_view pattern) const
+    {
+        if (pattern.empty())
+            return std::make_pair(0, 0);
+        int first = bound(pattern, false);
+        int last = bound(pattern, true);
+        return std::make_pair(first, last);
+    }
+
+    // count: Number of occurrences of P, in O(m log n).
+    std::size_t count(std::string_view pattern) const
+    {
+        std::pair<int, int> r = range(pattern);
+        return r.second - r.first;
+    }
+
+    // locate: Starting indices of all occurrences, in increasing order (like kmpMatchAll).
+    std::vector<int> locate(std::string_view pattern) const
+    {
+        std::pair<int, int> r = range(pattern);
+        std::vector<int> match_indices(sa.begin() + r.first, sa.begin() + r.second);
+        std::sort(match_indices.begin(), match_indices.end());
+        return match_indices;
+    }
+
+    // longestRepeat: The longest substring occurring at least twice (max LCP), in O(n).
+    std::string longestRepeat() const
+    {
+        int best = 0;
+        for (int i = 1; i < static_cast<int>(lcp.size()); ++i)
+        {
+            if (lcp[i] > lcp[best])
+                best = i;
+        }
+        return lcp.empty() ? std::string() : text.substr(sa[best], lcp[best]);
+    }
+
+    // countBatch: count() for every pattern, spread over 'threads' threads (0 = hardware concurrency).
+    std::vector<std::size_t> countBatch(const std::vector<std::string> &patterns, unsigned threads = 0) const
+    {
+        std::vector<std::size_t> counts(patterns.size());
+        forEachParallel(patterns.size(), threads, [&](std::size_t k) { counts[k] = count(patterns[k]); });
+        return counts;
+    }
+
+    // locateBatch: locate() for every pattern, spread over 'threads' threads.
+    std::vector<std::vector<int>> locateBatch(const std::vector<std::string> &patterns, unsigned threads = 0) const
+    {
+        std::vector<std::vector<int>> results(patterns.size());
+        forEachParallel(patterns.size(), threads, [&](std::size_t k) { results[k] = locate(patterns[k]); });
+        return results;
+    }
+};
+
+#endif // TEXTINDEX_H
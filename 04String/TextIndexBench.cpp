@@ -0,0 +1,99 @@
+#include <iostream>
+#include <iomanip> // For std::setw
+#include <string>
+#include <vector>
+#include <random>
+#include <thread>
+#include <cstdlib> // For std::atoi
+#include <utility> // For std::move
+#include "StringMatch.h"
+#include "TextIndex.h"
+#include "BenchUtil.h"
+
+/**
+ * Benchmark: TextIndex (SA-IS suffix array + LCP) vs rescanning with KMP.
+ * The corpus is English-like: words drawn from a small vocabulary with a
+ * skewed distribution. For each size it reports
+ *   - build time of the index and its size in bytes per text character,
+ *   - average latency of count() and locate() over many queries, and of one
+ *     kmpMatchAll() rescan per query,
+ *   - the number of queries after which building the index has paid off,
+ *   - countBatch() throughput per thread count.
+ * Queries are substrings of the text (lengths 4-32) plus absent words; all
+ * results are checked against kmpMatchAll on a sample.
+ *
+ * Usage: TextIndexBench [largest corpus in MB, default 64]
+ */
+
+int main(int argc, char *argv[])
+{
+    int max_mb = argc >= 2 ? std::atoi(argv[1]) : 64;
+    std::cout << "--- TextIndex Benchmark ---" << std::endl;
+    std::mt19937 rng(2025);
+
+    for (int mb = 1; mb <= max_mb; mb *= 4)
+    {
+        std::string text = EnglishLikeText(static_cast<std::size_t>(mb) << 20, rng);
+        std::vector<std::string> queries;
+        for (int k = 0; k < 20000; ++k)
+        {
+            std::size_t len = 4 + rng() % 29;
+            if (k % 10 == 0)
+                queries.push_back("zq" + std::to_string(k)); // Absent
+            else
+                queries.push_back(text.substr(rng() % (text.size() - len), len));
+        }
+
+        std::cout << "\nCorpus: " << mb << " MB English-like text" << std::endl;
+        std::string source = text; // The index keeps its own copy; made outside the timing
+        Clock::time_point start = Clock::now();
+        TextIndex index(std::move(source));
+        double build_ms = ElapsedMs(start);
+        std::cout << "  Build (SA-IS + LCP): " << std::fixed << std::setprecision(1) << build_ms << " ms ("
+                  << text.size() / build_ms / 1e3 << " MB/s)" << std::endl;
+        std::cout << "  Index size: " << std::setprecision(2) << static_cast<double>(index.memoryBytes()) / text.size()
+                  << " bytes/char (+1 for the text)" << std::endl;
+
+        std::size_t total = 0;
+        start = Clock::now();
+        for (const std::string &q : queries)
+            total += index.count(q);
+        double count_us = ElapsedMs(start) * 1e3 / queries.size();
+
+        start = Clock::now();
+        for (const std::string &q : queries)
+            total += index.locate(q).size();
+        double locate_us = ElapsedMs(start) * 1e3 / queries.size();
+
+        const int kScans = 10; // Each rescan reads the whole corpus
+        std::vector<std::vector<int>> rescans(kScans);
+        start = Clock::now();
+        for (int k = 0; k < kScans; ++k)
+            rescans[k] = kmpMatchAll(text, queries[k]);
+        double kmp_us = ElapsedMs(start) * 1e3 / kScans;
+        bool same = true;
+        for (int k = 0; k < kScans; ++k)
+            same = same && rescans[k] == index.locate(queries[k]);
+
+        std::cout << std::setprecision(2) << "  Latency per query: count " << count_us << " us, locate " << locate_us
+                  << " us, KMP rescan " << kmp_us << " us" << std::endl;
+        std::cout << "  Index pays off after " << static_cast<long long>(build_ms * 1e3 / (kmp_us - count_us) + 1)
+                  << " queries" << (same ? "" : " (Mismatch with kmpMatchAll!)") << std::endl;
+
+        std::cout << "  countBatch:";
+        unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned threads = 1; threads <= std::max(8u, hw); threads *= 2)
+        {
+            start = Clock::now();
+            std::vector<std::size_t> counts = index.countBatch(queries, threads);
+            double ms = ElapsedMs(start);
+            std::cout << "  " << threads << "T " << std::setprecision(0) << queries.size() / ms * 1e3 << " q/s";
+        }
+        std::cout << std::endl;
+        if (total == 0)
+            std::cout << "(no matches)" << std::endl; // Keeps the loops from being optimized away
+    }
+
+    std::cout << "\n--- Benchmark Complete ---" << std::endl;
+    return 0;
+}
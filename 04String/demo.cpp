@@ -2,6 +2,8 @@
 #include <cstring> // For strlen
 #include <iomanip> // For std::setw
 #include <vector>  // Include the vector header
+#include <string>
+#include "StringMatch.h"
 
 /**
  * @brief Helper function to print the N vector cleanly.
@@ -21,65 +23,30 @@ void printN(const std::vector<int> &N)
 }
 
 /**
- * @brief Computes the KMP 'Next' array with detailed logging.
+ * @brief Prints the counters collected by an instrumented call.
+ * @param stats The filled MatchStats.
+ */
+void printStats(const MatchStats &stats)
+{
+    std::cout << "  comparisons = " << stats.comparisons << ", shifts = " << stats.shifts
+              << ", table lookups = " << stats.lookups << std::endl;
+}
+
+/**
+ * @brief Computes the KMP 'Next' array and reports what it cost.
+ * The counting is done by computeNextTable itself (StringMatch.h) through the
+ * MatchStats policy, so nothing is printed per step and long patterns are fine.
  * @param P The pattern string.
  * @param N A reference to the vector to store the Next values.
  */
-void Next_with_log(char *P, std::vector<int> &N)
+void Next_with_stats(char *P, std::vector<int> &N)
 {
-    int m = strlen(P);
-    if (m == 0)
-        return;
-
-    // N[0] = 0; (The vector is already 0-initialized)
+    MatchStats stats;
+    N = computeNextTable(P, stats);
 
-    int i = 1; // Current index in pattern P
-    int j = 0; // Length of the previous longest prefix-suffix
-
-    std::cout << "--- Initial State ---" << std::endl;
-    std::cout << "  Pattern: " << P << " (m = " << m << ")" << std::endl;
-    std::cout << "  i = " << i << ", j = " << j << std::endl;
+    std::cout << "  Pattern: " << P << " (m = " << strlen(P) << ")" << std::endl;
     printN(N);
-    std::cout << "---------------------" << std::endl;
-
-    while (i < m)
-    {
-        std::cout << "Step: (i=" << i << ", j=" << j << ")" << std::endl;
-        std::cout << "  Comparing P[i] (P[" << i << "] = '" << P[i] << "') with P[j] (P[" << j << "] = '" << P[j] << "')" << std::endl;
-
-        if (P[i] == P[j])
-        {
-            std::cout << "  > Match!" << std::endl;
-            N[i] = j + 1;
-            std::cout << "  > Set N[" << i << "] = j + 1 = " << N[i] << std::endl;
-            i++;
-            j++;
-        }
-        else
-        {
-            std::cout << "  > Mismatch." << std::endl;
-            if (j > 0)
-            {
-                std::cout << "  > j > 0 (" << j << "), backtracking." << std::endl;
-                std::cout << "  > Set j = N[j - 1] = N[" << j - 1 << "] = " << N[j - 1] << std::endl;
-                j = N[j - 1];
-            }
-            else
-            {
-                std::cout << "  > j is 0, cannot backtrack." << std::endl;
-                N[i] = 0;
-                std::cout << "  > Set N[" << i << "] = 0" << std::endl;
-                i++;
-            }
-        }
-        std::cout << "  End of step. New state: (i=" << i << ", j=" << j << ")" << std::endl;
-        printN(N);
-        std::cout << "---------------------" << std::endl;
-    }
-
-    std::cout << "--- Final N Array ---" << std::endl;
-    printN(N);
-    std::cout << "---------------------" << std::endl;
+    printStats(stats);
 }
 
 int main()
@@ -92,7 +59,7 @@ int main()
 
     std::cout << "Calculating Next for pattern: " << P1 << "\n"
               << std::endl;
-    Next_with_log(P1, N1);
+    Next_with_stats(P1, N1);
 
     // Example pattern 2
     std::cout << "\n\nCalculating Next for pattern: AAAA\n"
@@ -101,7 +68,7 @@ int main()
     int m2 = strlen(P2);
     std::vector<int> N2(m2, 0);
 
-    Next_with_log(P2, N2);
+    Next_with_stats(P2, N2);
 
     // Example pattern 3
     std::cout << "\n\nCalculating Next for pattern: ABCDE\n"
@@ -110,7 +77,25 @@ int main()
     int m3 = strlen(P3);
     std::vector<int> N3(m3, 0);
 
-    Next_with_log(P3, N3);
+    Next_with_stats(P3, N3);
+
+    // Profiling the matchers on a larger input: same code, MatchStats policy
+    std::cout << "\n\nSearching \"aaa...ab\" (m = 16) in 100000 x 'a' + 'b'\n"
+              << std::endl;
+    std::string T(100000, 'a');
+    T += 'b';
+    std::string P(15, 'a');
+    P += 'b';
+    MatchStats bf, kmp, horspool;
+    bruteForceMatchAll(T, P, bf);
+    kmpMatchAll(T, P, kmp);
+    horspoolMatchAll(T, P, horspool);
+    std::cout << "Brute force:" << std::endl;
+    printStats(bf);
+    std::cout << "KMP:" << std::endl;
+    printStats(kmp);
+    std::cout << "Horspool:" << std::endl;
+    printStats(horspool);
 
     // No delete[] needed! The vectors clean themselves up.
     return 0;